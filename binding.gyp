@@ -11,16 +11,26 @@
                         "src/native/argon2.c",
                         "src/native/blake2/blake2b.c",
                         "src/native/core.c",
+                        "src/native/cpu.c",
                         "src/native/encoding.c",
                         "src/native/nimiq_native.c",
                         "src/native/sha256.c",
+                        "src/native/hmac_sha512.c",
+                        "src/native/pbkdf2_sha512.c",
+                        "src/native/slip10.c",
+                        "src/native/vanity.c",
                         "src/native/ed25519/collective.c",
                         "src/native/ed25519/fe.c",
+                        "src/native/ed25519/fe51.c",
                         "src/native/ed25519/ge.c",
+                        "src/native/ed25519/ge_avx2.c",
+                        "src/native/ed25519/key_cache.c",
                         "src/native/ed25519/keypair.c",
                         "src/native/ed25519/memory.c",
                         "src/native/ed25519/sc.c",
+                        "src/native/ed25519/sc64.c",
                         "src/native/ed25519/sha512.c",
+                        "src/native/ed25519/sig_cache.c",
                         "src/native/ed25519/sign.c",
                         "src/native/ed25519/verify.c",
                         "src/native/nimiq_node.cc"
@@ -32,7 +42,8 @@
                         ["OS=='mac' and target_arch!='arm64'", {"xcode_settings": {"OTHER_CFLAGS": ["-march=native"]} }],
                     ],
                     "defines": [
-                        "ARGON2_NO_THREADS"
+                        "ARGON2_NO_THREADS",
+                        "ED25519_BASE_WINDOW=6"
                     ],
                     "include_dirs": [
                         "<!(node -e \"require('nan')\")",
@@ -53,23 +64,34 @@
                         "src/native/argon2.c",
                         "src/native/blake2/blake2b.c",
                         "src/native/core.c",
+                        "src/native/cpu.c",
                         "src/native/encoding.c",
                         "src/native/nimiq_native.c",
                         "src/native/ref.c",
                         "src/native/sha256.c",
+                        "src/native/hmac_sha512.c",
+                        "src/native/pbkdf2_sha512.c",
+                        "src/native/slip10.c",
+                        "src/native/vanity.c",
                         "src/native/ed25519/collective.c",
                         "src/native/ed25519/fe.c",
+                        "src/native/ed25519/fe51.c",
                         "src/native/ed25519/ge.c",
+                        "src/native/ed25519/ge_avx2.c",
+                        "src/native/ed25519/key_cache.c",
                         "src/native/ed25519/keypair.c",
                         "src/native/ed25519/memory.c",
                         "src/native/ed25519/sc.c",
+                        "src/native/ed25519/sc64.c",
                         "src/native/ed25519/sha512.c",
+                        "src/native/ed25519/sig_cache.c",
                         "src/native/ed25519/sign.c",
                         "src/native/ed25519/verify.c",
                         "src/native/nimiq_node.cc"
                     ],
                     "defines": [
-                        "ARGON2_NO_THREADS"
+                        "ARGON2_NO_THREADS",
+                        "ED25519_BASE_WINDOW=6"
                     ],
                     "include_dirs": [
                         "<!(node -e \"require('nan')\")",
@@ -91,23 +113,34 @@
                         "src/native/argon2.c",
                         "src/native/blake2/blake2b.c",
                         "src/native/core.c",
+                        "src/native/cpu.c",
                         "src/native/encoding.c",
                         "src/native/nimiq_native.c",
                         "src/native/ref.c",
                         "src/native/sha256.c",
+                        "src/native/hmac_sha512.c",
+                        "src/native/pbkdf2_sha512.c",
+                        "src/native/slip10.c",
+                        "src/native/vanity.c",
                         "src/native/ed25519/collective.c",
                         "src/native/ed25519/fe.c",
+                        "src/native/ed25519/fe51.c",
                         "src/native/ed25519/ge.c",
+                        "src/native/ed25519/ge_avx2.c",
+                        "src/native/ed25519/key_cache.c",
                         "src/native/ed25519/keypair.c",
                         "src/native/ed25519/memory.c",
                         "src/native/ed25519/sc.c",
+                        "src/native/ed25519/sc64.c",
                         "src/native/ed25519/sha512.c",
+                        "src/native/ed25519/sig_cache.c",
                         "src/native/ed25519/sign.c",
                         "src/native/ed25519/verify.c",
                         "src/native/nimiq_node.cc"
                     ],
                     "defines": [
-                        "ARGON2_NO_THREADS"
+                        "ARGON2_NO_THREADS",
+                        "ED25519_BASE_WINDOW=6"
                     ],
                     "include_dirs": [
                         "<!(node -e \"require('nan')\")",
@@ -131,23 +164,34 @@
                         "src/native/argon2.c",
                         "src/native/blake2/blake2b.c",
                         "src/native/core.c",
+                        "src/native/cpu.c",
                         "src/native/encoding.c",
                         "src/native/nimiq_native.c",
                         "src/native/opt.c",
                         "src/native/sha256.c",
+                        "src/native/hmac_sha512.c",
+                        "src/native/pbkdf2_sha512.c",
+                        "src/native/slip10.c",
+                        "src/native/vanity.c",
                         "src/native/ed25519/collective.c",
                         "src/native/ed25519/fe.c",
+                        "src/native/ed25519/fe51.c",
                         "src/native/ed25519/ge.c",
+                        "src/native/ed25519/ge_avx2.c",
+                        "src/native/ed25519/key_cache.c",
                         "src/native/ed25519/keypair.c",
                         "src/native/ed25519/memory.c",
                         "src/native/ed25519/sc.c",
+                        "src/native/ed25519/sc64.c",
                         "src/native/ed25519/sha512.c",
+                        "src/native/ed25519/sig_cache.c",
                         "src/native/ed25519/sign.c",
                         "src/native/ed25519/verify.c",
                         "src/native/nimiq_node.cc"
                     ],
                     "defines": [
-                        "ARGON2_NO_THREADS"
+                        "ARGON2_NO_THREADS",
+                        "ED25519_BASE_WINDOW=6"
                     ],
                     "include_dirs": [
                         "<!(node -e \"require('nan')\")",
@@ -175,23 +219,34 @@
                         "src/native/argon2.c",
                         "src/native/blake2/blake2b.c",
                         "src/native/core.c",
+                        "src/native/cpu.c",
                         "src/native/encoding.c",
                         "src/native/nimiq_native.c",
                         "src/native/opt.c",
                         "src/native/sha256.c",
+                        "src/native/hmac_sha512.c",
+                        "src/native/pbkdf2_sha512.c",
+                        "src/native/slip10.c",
+                        "src/native/vanity.c",
                         "src/native/ed25519/collective.c",
                         "src/native/ed25519/fe.c",
+                        "src/native/ed25519/fe51.c",
                         "src/native/ed25519/ge.c",
+                        "src/native/ed25519/ge_avx2.c",
+                        "src/native/ed25519/key_cache.c",
                         "src/native/ed25519/keypair.c",
                         "src/native/ed25519/memory.c",
                         "src/native/ed25519/sc.c",
+                        "src/native/ed25519/sc64.c",
                         "src/native/ed25519/sha512.c",
+                        "src/native/ed25519/sig_cache.c",
                         "src/native/ed25519/sign.c",
                         "src/native/ed25519/verify.c",
                         "src/native/nimiq_node.cc"
                     ],
                     "defines": [
-                        "ARGON2_NO_THREADS"
+                        "ARGON2_NO_THREADS",
+                        "ED25519_BASE_WINDOW=6"
                     ],
                     "include_dirs": [
                         "<!(node -e \"require('nan')\")",
@@ -221,23 +276,34 @@
                         "src/native/argon2.c",
                         "src/native/blake2/blake2b.c",
                         "src/native/core.c",
+                        "src/native/cpu.c",
                         "src/native/encoding.c",
                         "src/native/nimiq_native.c",
                         "src/native/opt.c",
                         "src/native/sha256.c",
+                        "src/native/hmac_sha512.c",
+                        "src/native/pbkdf2_sha512.c",
+                        "src/native/slip10.c",
+                        "src/native/vanity.c",
                         "src/native/ed25519/collective.c",
                         "src/native/ed25519/fe.c",
+                        "src/native/ed25519/fe51.c",
                         "src/native/ed25519/ge.c",
+                        "src/native/ed25519/ge_avx2.c",
+                        "src/native/ed25519/key_cache.c",
                         "src/native/ed25519/keypair.c",
                         "src/native/ed25519/memory.c",
                         "src/native/ed25519/sc.c",
+                        "src/native/ed25519/sc64.c",
                         "src/native/ed25519/sha512.c",
+                        "src/native/ed25519/sig_cache.c",
                         "src/native/ed25519/sign.c",
                         "src/native/ed25519/verify.c",
                         "src/native/nimiq_node.cc"
                     ],
                     "defines": [
-                        "ARGON2_NO_THREADS"
+                        "ARGON2_NO_THREADS",
+                        "ED25519_BASE_WINDOW=6"
                     ],
                     "include_dirs": [
                         "<!(node -e \"require('nan')\")",
@@ -555,6 +555,11 @@ export class IteratorUtils {
     public static alternate<T>(...iterators: Array<Iterator<T>>): Iterable<T>;
 }
 
+export class NativeUtils {
+    public static readonly THREADS: number;
+    public static mapChunks<T>(count: number, threads: number, fn: (start: number, end: number) => Promise<T>): Promise<T[]>;
+}
+
 export class ArrayUtils {
     public static randomElement(arr: any[]): any;
     public static subarray(uintarr: Uint8Array, begin?: number, end?: number): Uint8Array;
@@ -731,10 +736,16 @@ export class Assert {
     public static that(condition: boolean, message?: string): void;
 }
 
+export class HmacSha512 {
+    constructor(key: Uint8Array);
+    public compute(data: Uint8Array): Uint8Array;
+}
+
 export class CryptoUtils {
     public static SHA512_BLOCK_SIZE: 128;
     public static computeHmacSha512(key: Uint8Array, data: Uint8Array): Uint8Array;
     public static computePBKDF2sha512(password: Uint8Array, salt: Uint8Array, iterations: number, derivedKeyLength: number): SerialBuffer;
+    public static computePBKDF2sha512Async(password: Uint8Array, salt: Uint8Array, iterations: number, derivedKeyLength: number): Promise<SerialBuffer>;
     public static otpKdfLegacy(message: Uint8Array, key: Uint8Array, salt: Uint8Array, iterations: number): Promise<Uint8Array>;
     public static otpKdf(message: Uint8Array, key: Uint8Array, salt: Uint8Array, iterations: number): Promise<Uint8Array>;
 }
@@ -1030,7 +1041,7 @@ export class Hash extends Serializable {
     public static argon2d(arr: Uint8Array): Promise<Hash>;
     public static sha256(arr: Uint8Array): Hash;
     public static sha512(arr: Uint8Array): Hash;
-    public static compute(arr: Uint8Array, algorithm: Hash.Algorithm.BLAKE2B | Hash.Algorithm.SHA256): Hash;
+    public static compute(arr: Uint8Array, algorithm: Hash.Algorithm.BLAKE2B | Hash.Algorithm.SHA256, depth?: number): Hash;
     public static unserialize(buf: SerialBuffer, algorithm?: Hash.Algorithm): Hash;
     public static fromAny(hash: Hash | Uint8Array | string, algorithm?: Hash.Algorithm): Hash;
     public static fromBase64(base64: string): Hash;
@@ -1042,6 +1053,8 @@ export class Hash extends Serializable {
     public static computeBlake2b(input: Uint8Array): Uint8Array;
     public static computeSha256(input: Uint8Array): Uint8Array;
     public static computeSha512(input: Uint8Array): Uint8Array;
+    public static computeChain(input: Uint8Array, algorithm: Hash.Algorithm, depth: number): Uint8Array;
+    public static computeChainAsync(input: Uint8Array, algorithm: Hash.Algorithm, depth: number): Promise<Uint8Array>;
     public serializedSize: number;
     public array: Uint8Array;
     public algorithm: Hash.Algorithm;
@@ -1078,7 +1091,10 @@ export class PublicKey extends Serializable {
     public static SIZE: 32;
     public static copy(o: PublicKey): PublicKey;
     public static derive(privateKey: PrivateKey): PublicKey;
+    public static deriveMany(privateKeys: PrivateKey[]): PublicKey[];
+    public static deriveAddressesAsync(privateKeys: PrivateKey[], threads?: number): Promise<Address[]>;
     public static sum(publicKeys: PublicKey[]): PublicKey;
+    public static getCacheStats(): { hits: number, misses: number };
     public static unserialize(buf: SerialBuffer): PublicKey;
     public static fromAny(o: PublicKey | Uint8Array | string): PublicKey;
     public serializedSize: number;
@@ -1094,6 +1110,8 @@ export class PublicKey extends Serializable {
 export class KeyPair extends Serializable {
     public static LOCK_KDF_ROUNDS: 256;
     public static generate(): KeyPair;
+    public static generateMany(privateKeys: Uint8Array, publicKeys?: Uint8Array | null, addresses?: Uint8Array | null): void;
+    public static generateManyAsync(privateKeys: Uint8Array, publicKeys?: Uint8Array | null, addresses?: Uint8Array | null, threads?: number): Promise<void>;
     public static derive(privateKey: PrivateKey): KeyPair;
     public static fromHex(hexBuf: string): KeyPair;
     public static fromEncrypted(buf: SerialBuffer, key: Uint8Array): Promise<KeyPair>;
@@ -1167,11 +1185,29 @@ export class ExtendedPrivateKey extends Serializable {
     constructor(key: PrivateKey, chainCode: Uint8Array);
     public derive(index: number): ExtendedPrivateKey;
     public derivePath(path: string): ExtendedPrivateKey;
+    public deriveRange(template: string, firstIndex: number, count: number): { privateKeys: PrivateKey[], publicKeys: PublicKey[], addresses: Address[] };
+    public deriveRangeAsync(template: string, firstIndex: number, count: number, threads?: number): Promise<{ privateKeys: PrivateKey[], publicKeys: PublicKey[], addresses: Address[] }>;
     public serialize(buf?: SerialBuffer): SerialBuffer;
     public equals(o: any): boolean;
     public toAddress(): Address;
 }
 
+export class VanityAddressSearch {
+    public static KEY_SIZE: 32;
+    public static ADDRESS_CHARS: 32;
+    public static MATCH_PREFIX: 0;
+    public static MATCH_SUFFIX: 1;
+    public static CHUNK_SIZE: number;
+    public static JS_CHUNK_SIZE: number;
+    public pattern: string;
+    public suffix: boolean;
+    public candidates: number;
+    constructor(pattern: string, suffix?: boolean);
+    public find(count?: number, threads?: number): Promise<KeyPair[]>;
+    public stop(): void;
+    public matches(address: Address): boolean;
+}
+
 export class RandomSecret extends Serializable {
     public static SIZE: 32;
     public static unserialize(buf: SerialBuffer): RandomSecret;
@@ -1188,6 +1224,9 @@ export class Signature extends Serializable {
     public static fromPartialSignatures(commitment: Commitment, signatures: PartialSignature[]): Signature;
     public static unserialize(buf: SerialBuffer): Signature;
     public static fromAny(o: Signature | Uint8Array | string): Signature;
+    public static verifyBatch(signatures: Signature[], publicKeys: PublicKey[], data: Uint8Array[]): boolean[];
+    public static verifyManyAsync(signatures: Signature[], publicKeys: PublicKey[], data: Uint8Array[], threads?: number): Promise<boolean[]>;
+    public static getCacheStats(): { hits: number, misses: number };
     public serializedSize: number;
     constructor(args: Uint8Array);
     public serialize(buf?: SerialBuffer): SerialBuffer;
@@ -1195,6 +1234,14 @@ export class Signature extends Serializable {
     public equals(o: any): boolean;
 }
 
+export class SigningKey {
+    public publicKey: PublicKey;
+    constructor(privateKey: PrivateKey);
+    public sign(data: Uint8Array): Signature;
+    public signMany(data: Uint8Array[]): Signature[];
+    public signManyAsync(data: Uint8Array[], threads?: number): Promise<Signature[]>;
+}
+
 export class Commitment extends Serializable {
     public static SIZE: 32;
     public static copy(o: Commitment): Commitment;
@@ -1210,6 +1257,7 @@ export class CommitmentPair extends Serializable {
     public static SERIALIZED_SIZE: 96;
     public static RANDOMNESS_SIZE: 32;
     public static generate(): CommitmentPair;
+    public static generateMany(count: number): CommitmentPair[];
     public static unserialize(buf: SerialBuffer): CommitmentPair;
     public static fromHex(hexBuf: string): CommitmentPair;
     public secret: RandomSecret;
@@ -1230,6 +1278,15 @@ export class PartialSignature extends Serializable {
     public equals(o: any): boolean;
 }
 
+export class MultiSigContext {
+    public publicKeys: PublicKey[];
+    public aggregatePublicKey: PublicKey;
+    constructor(publicKeys: PublicKey[], privateKey?: PrivateKey, publicKey?: PublicKey);
+    public partialSign(secret: RandomSecret, aggregateCommitment: Commitment, data: Uint8Array): PartialSignature;
+    public verifyPartialSignature(publicKey: PublicKey, partialSignature: PartialSignature, commitment: Commitment, aggregateCommitment: Commitment, data: Uint8Array): boolean;
+    public verifyPartialSignatures(partialSignatures: PartialSignature[], commitments: Commitment[], aggregateCommitment: Commitment, data: Uint8Array): boolean[];
+}
+
 export class MnemonicUtils {
     public static ENGLISH_WORDLIST: string[];
     public static DEFAULT_WORDLIST: string[];
@@ -1243,7 +1300,9 @@ export class MnemonicUtils {
     public static mnemonicToEntropy(mnemonic: string | string[], wordlist?: string[]): Entropy;
     public static legacyMnemonicToEntropy(mnemonic: string | string[], wordlist?: string[]): Entropy;
     public static mnemonicToSeed(mnemonic: string | string[], password?: string): SerialBuffer;
+    public static mnemonicToSeedAsync(mnemonic: string | string[], password?: string): Promise<SerialBuffer>;
     public static mnemonicToExtendedPrivateKey(mnemonic: string | string[], password?: string): ExtendedPrivateKey;
+    public static mnemonicToExtendedPrivateKeyAsync(mnemonic: string | string[], password?: string): Promise<ExtendedPrivateKey>;
     public static isCollidingChecksum(entropy: Entropy): boolean;
     public static getMnemonicType(mnemonic: string | string[], wordlist?: string[]): MnemonicUtils.MnemonicType;
 }
@@ -1930,6 +1989,7 @@ export namespace Transaction {
 export class SignatureProof {
     public static SINGLE_SIG_SIZE: number;
     public static verifyTransaction(transaction: Transaction): boolean;
+    public static verifyTransactionsAsync(transactions: Transaction[], threads?: number): Promise<void>;
     public static singleSig(publicKey: PublicKey, signature: Signature): SignatureProof;
     public static multiSig(signerKey: PublicKey, publicKeys: PublicKey[], signature: Signature): SignatureProof;
     public static unserialize(buf: SerialBuffer): SignatureProof;
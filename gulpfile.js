@@ -66,6 +66,7 @@ const sources = {
         './src/main/generic/utils/Time.js',
         './src/main/generic/utils/EventLoopHelper.js',
         './src/main/generic/utils/IteratorUtils.js',
+        './src/main/generic/utils/NativeUtils.js',
         './src/main/generic/utils/array/ArrayUtils.js',
         './src/main/generic/utils/array/HashMap.js',
         './src/main/generic/utils/array/HashSet.js',
@@ -89,6 +90,7 @@ const sources = {
         './src/main/generic/utils/IWorker.js',
         './src/main/generic/utils/crypto/CryptoWorker.js',
         './src/main/generic/utils/crypto/CryptoWorkerImpl.js',
+        './src/main/generic/utils/crypto/HmacSha512.js',
         './src/main/generic/utils/crypto/CryptoUtils.js',
         './src/main/generic/utils/crc/CRC8.js',
         './src/main/generic/utils/crc/CRC32.js',
@@ -108,11 +110,14 @@ const sources = {
         './src/main/generic/consensus/base/primitive/KeyPair.js',
         './src/main/generic/consensus/base/primitive/Entropy.js',
         './src/main/generic/consensus/base/primitive/ExtendedPrivateKey.js',
+        './src/main/generic/consensus/base/primitive/VanityAddressSearch.js',
         './src/main/generic/consensus/base/primitive/RandomSecret.js',
         './src/main/generic/consensus/base/primitive/Signature.js',
+        './src/main/generic/consensus/base/primitive/SigningKey.js',
         './src/main/generic/consensus/base/primitive/Commitment.js',
         './src/main/generic/consensus/base/primitive/CommitmentPair.js',
         './src/main/generic/consensus/base/primitive/PartialSignature.js',
+        './src/main/generic/consensus/base/primitive/MultiSigContext.js',
         './src/main/generic/consensus/base/account/Address.js',
         './src/main/generic/consensus/base/account/Account.js',
         './src/main/generic/consensus/base/account/PrunedAccount.js',
@@ -257,6 +262,7 @@ const sources = {
     ],
     offline: [
         './src/main/generic/utils/array/ArrayUtils.js',
+        './src/main/generic/utils/NativeUtils.js',
         './src/main/generic/utils/assert/Assert.js',
         './src/main/generic/utils/buffer/BufferUtils.js',
         './src/main/generic/utils/buffer/SerialBuffer.js',
@@ -276,11 +282,14 @@ const sources = {
         './src/main/generic/consensus/base/primitive/KeyPair.js',
         './src/main/generic/consensus/base/primitive/Entropy.js',
         './src/main/generic/consensus/base/primitive/ExtendedPrivateKey.js',
+        './src/main/generic/consensus/base/primitive/VanityAddressSearch.js',
         './src/main/generic/consensus/base/primitive/RandomSecret.js',
         './src/main/generic/consensus/base/primitive/Signature.js',
+        './src/main/generic/consensus/base/primitive/SigningKey.js',
         './src/main/generic/consensus/base/primitive/Commitment.js',
         './src/main/generic/consensus/base/primitive/CommitmentPair.js',
         './src/main/generic/consensus/base/primitive/PartialSignature.js',
+        './src/main/generic/consensus/base/primitive/MultiSigContext.js',
         './src/main/generic/consensus/base/account/Address.js',
         './src/main/generic/consensus/base/account/Account.js',
         './src/main/generic/consensus/base/account/BasicAccount.js',
@@ -293,6 +302,7 @@ const sources = {
         './src/main/generic/consensus/base/transaction/ExtendedTransaction.js',
         './src/main/generic/utils/IWorker.js',
         './src/main/generic/utils/crypto/CryptoWorker.js',
+        './src/main/generic/utils/crypto/HmacSha512.js',
         './src/main/generic/utils/crypto/CryptoUtils.js',
         './src/main/generic/consensus/GenesisConfigOffline.js'
     ],
@@ -313,6 +323,7 @@ const sources = {
         './src/main/platform/browser/WasmHelper.js',
         './src/main/platform/browser/worker/GenesisConfig.js',
         './src/main/generic/utils/array/ArrayUtils.js',
+        './src/main/generic/utils/NativeUtils.js',
         './src/main/generic/utils/assert/Assert.js',
         './src/main/generic/utils/buffer/SerialBuffer.js',
         './src/main/generic/utils/merkle/MerkleTree.js',
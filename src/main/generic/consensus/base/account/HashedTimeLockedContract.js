@@ -196,8 +196,8 @@ class HashedTimeLockedContract extends Contract {
                     let preImage = Hash.unserialize(buf, hashAlgorithm);
 
                     // Verify that the preImage hashed hashDepth times matches the _provided_ hashRoot.
-                    for (let i = 0; i < hashDepth; ++i) {
-                        preImage = Hash.compute(preImage.array, hashAlgorithm);
+                    if (hashDepth > 0) {
+                        preImage = Hash.compute(preImage.array, hashAlgorithm, hashDepth);
                     }
                     if (!hashRoot.equals(preImage)) {
                         return false;
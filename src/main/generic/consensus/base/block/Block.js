@@ -67,6 +67,10 @@ class Block {
      */
     async verify(time) {
         if (this._valid === undefined) {
+            if (this.isFull() && PlatformUtils.isNodeJs()) {
+                // Check the transaction signatures in parallel on the native thread pool first.
+                await SignatureProof.verifyTransactionsAsync(this.body.transactions);
+            }
             if (this.isLight() || this.body.transactions.length < 150 || !IWorker.areWorkersAsync) {
                 // worker overhead doesn't pay off for small transaction numbers
                 this._valid = await this._verify(time.now());
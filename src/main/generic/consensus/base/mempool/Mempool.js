@@ -42,7 +42,15 @@ class Mempool extends Observable {
      * @returns {Promise.<Mempool.ReturnCode>}
      */
     pushTransaction(transaction) {
-        return this._synchronizer.push(() => this._pushTransaction(transaction));
+        // Start checking the signature on the native thread pool right away, so that the signatures of
+        // concurrently pushed transactions are checked in parallel while they wait for the synchronizer.
+        const verified = this._transactionsByHash.contains(transaction.hash())
+            ? Promise.resolve()
+            : SignatureProof.verifyTransactionsAsync([transaction]);
+        return this._synchronizer.push(async () => {
+            await verified;
+            return this._pushTransaction(transaction);
+        });
     }
 
     /**
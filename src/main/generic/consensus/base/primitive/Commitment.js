@@ -72,7 +72,9 @@ class Commitment extends Serializable {
         }
         if (PlatformUtils.isNodeJs()) {
             const out = new Uint8Array(Commitment.SIZE);
-            NodeNative.node_ed25519_aggregate_commitments(out, concatenatedCommitments, commitments.length);
+            if (NodeNative.node_ed25519_aggregate_commitments(out, concatenatedCommitments, commitments.length) !== 1) {
+                throw new Error('Primitive: Invalid commitment');
+            }
             return out;
         } else {
             let stackPtr;
@@ -81,6 +83,7 @@ class Commitment extends Serializable {
                 const wasmOut = Module.stackAlloc(Commitment.SIZE);
                 const wasmInCommitments = Module.stackAlloc(concatenatedCommitments.length);
                 new Uint8Array(Module.HEAPU8.buffer, wasmInCommitments, concatenatedCommitments.length).set(concatenatedCommitments);
+                // The shipped wasm predates the result of ed25519_aggregate_commitments, so it is not checked here.
                 Module._ed25519_aggregate_commitments(wasmOut, wasmInCommitments, commitments.length);
                 const aggCommitments = new Uint8Array(Commitment.SIZE);
                 aggCommitments.set(new Uint8Array(Module.HEAPU8.buffer, wasmOut, Commitment.SIZE));
@@ -18,6 +18,12 @@ class ExtendedPrivateKey extends Serializable {
      * @return {ExtendedPrivateKey}
      */
     static generateMasterKey(seed) {
+        if (PlatformUtils.isNodeJs()) {
+            const extendedKey = new SerialBuffer(PrivateKey.SIZE + ExtendedPrivateKey.CHAIN_CODE_SIZE);
+            NodeNative.node_slip10_master_key(extendedKey, new Uint8Array(seed));
+            return ExtendedPrivateKey.unserialize(extendedKey);
+        }
+
         const bCurve = BufferUtils.fromAscii('ed25519 seed');
         const hash = CryptoUtils.computeHmacSha512(bCurve, seed);
         return new ExtendedPrivateKey(new PrivateKey(hash.slice(0, 32)), hash.slice(32));
@@ -82,6 +88,119 @@ class ExtendedPrivateKey extends Serializable {
         return extendedKey.derivePath(path);
     }
 
+    /**
+     * Parses a path template like m/44'/242'/0'/i' with exactly one variable level i'.
+     * @param {string} template
+     * @return {{path: Uint32Array, variableLevel: number}}
+     * @private
+     */
+    static _parsePathTemplate(template) {
+        if (template.match(/^m(\/([0-9]+|i)')+$/) === null) throw new Error('Invalid path template');
+
+        const segments = template.split('/').slice(1);
+        const variableLevel = segments.indexOf('i\'');
+        if (variableLevel < 0 || segments.lastIndexOf('i\'') !== variableLevel) throw new Error('Invalid path template');
+
+        const path = new Uint32Array(segments.length);
+        for (let i = 0; i < segments.length; i++) {
+            if (i === variableLevel) continue;
+            const index = parseInt(segments[i]);
+            if (!NumberUtils.isUint32(index)) throw new Error('Invalid path template');
+            path[i] = index;
+        }
+        return {path, variableLevel};
+    }
+
+    /**
+     * Derives the keys and addresses for the indices firstIndex ... firstIndex + count - 1
+     * of the variable level of a path template like m/44'/242'/0'/i'.
+     * @param {string} template
+     * @param {number} firstIndex
+     * @param {number} count
+     * @return {{privateKeys: Array.<PrivateKey>, publicKeys: Array.<PublicKey>, addresses: Array.<Address>}}
+     */
+    deriveRange(template, firstIndex, count) {
+        const {path, variableLevel} = ExtendedPrivateKey._parsePathTemplate(template);
+        if (!NumberUtils.isUint32(firstIndex) || !NumberUtils.isUint32(firstIndex + count)) throw new Error('Invalid index range');
+
+        if (PlatformUtils.isNodeJs()) {
+            const privateKeys = new Uint8Array(count * PrivateKey.SIZE);
+            const publicKeys = new Uint8Array(count * PublicKey.SIZE);
+            const addresses = new Uint8Array(count * Address.SERIALIZED_SIZE);
+            NodeNative.node_slip10_derive_range(privateKeys, publicKeys, addresses, this.serialize(), path, variableLevel, firstIndex, count);
+            return ExtendedPrivateKey._rangeResult(privateKeys, publicKeys, addresses, count);
+        }
+
+        const result = {privateKeys: [], publicKeys: [], addresses: []};
+        let parent = this;
+        for (let i = 0; i < variableLevel; i++) {
+            parent = parent.derive(path[i]);
+        }
+        for (let i = 0; i < count; i++) {
+            let key = parent.derive(firstIndex + i);
+            for (let j = variableLevel + 1; j < path.length; j++) {
+                key = key.derive(path[j]);
+            }
+            const publicKey = PublicKey.derive(key.privateKey);
+            result.privateKeys.push(key.privateKey);
+            result.publicKeys.push(publicKey);
+            result.addresses.push(publicKey.toAddress());
+        }
+        return result;
+    }
+
+    /**
+     * Like deriveRange, but in NodeJS the range is split into chunks that are derived in parallel on the native thread pool.
+     * @param {string} template
+     * @param {number} firstIndex
+     * @param {number} count
+     * @param {number} [threads]
+     * @return {Promise.<{privateKeys: Array.<PrivateKey>, publicKeys: Array.<PublicKey>, addresses: Array.<Address>}>}
+     */
+    async deriveRangeAsync(template, firstIndex, count, threads = NativeUtils.THREADS) {
+        if (!PlatformUtils.isNodeJs()) return this.deriveRange(template, firstIndex, count);
+
+        const {path, variableLevel} = ExtendedPrivateKey._parsePathTemplate(template);
+        if (!NumberUtils.isUint32(firstIndex) || !NumberUtils.isUint32(firstIndex + count)) throw new Error('Invalid index range');
+
+        const parent = this.serialize();
+        const chunks = await NativeUtils.mapChunks(count, threads, (start, end) => {
+            const size = end - start;
+            const privateKeys = new Uint8Array(size * PrivateKey.SIZE);
+            const publicKeys = new Uint8Array(size * PublicKey.SIZE);
+            const addresses = new Uint8Array(size * Address.SERIALIZED_SIZE);
+            return new Promise(resolve => {
+                NodeNative.node_slip10_derive_range_async(resolve, privateKeys, publicKeys, addresses, parent, path, variableLevel, firstIndex + start, size);
+            }).then(() => ExtendedPrivateKey._rangeResult(privateKeys, publicKeys, addresses, size));
+        });
+
+        const result = {privateKeys: [], publicKeys: [], addresses: []};
+        for (const chunk of chunks) {
+            result.privateKeys.push(...chunk.privateKeys);
+            result.publicKeys.push(...chunk.publicKeys);
+            result.addresses.push(...chunk.addresses);
+        }
+        return result;
+    }
+
+    /**
+     * @param {Uint8Array} privateKeys
+     * @param {Uint8Array} publicKeys
+     * @param {Uint8Array} addresses
+     * @param {number} count
+     * @return {{privateKeys: Array.<PrivateKey>, publicKeys: Array.<PublicKey>, addresses: Array.<Address>}}
+     * @private
+     */
+    static _rangeResult(privateKeys, publicKeys, addresses, count) {
+        const result = {privateKeys: [], publicKeys: [], addresses: []};
+        for (let i = 0; i < count; i++) {
+            result.privateKeys.push(new PrivateKey(privateKeys.slice(i * PrivateKey.SIZE, (i + 1) * PrivateKey.SIZE)));
+            result.publicKeys.push(new PublicKey(publicKeys.slice(i * PublicKey.SIZE, (i + 1) * PublicKey.SIZE)));
+            result.addresses.push(new Address(addresses.slice(i * Address.SERIALIZED_SIZE, (i + 1) * Address.SERIALIZED_SIZE)));
+        }
+        return result;
+    }
+
     /**
      * @param {SerialBuffer} buf
      * @return {ExtendedPrivateKey}
@@ -70,17 +70,24 @@ class Hash extends Serializable {
     /**
      * @param {Uint8Array} arr
      * @param {Hash.Algorithm} algorithm
+     * @param {number} [depth] Number of times the hash is applied, must be at least 1.
      * @returns {Hash}
      */
-    static compute(arr, algorithm) {
+    static compute(arr, algorithm, depth = 1) {
         // !! The algorithms supported by this function are the allowed hash algorithms for HTLCs !!
         switch (algorithm) {
-            case Hash.Algorithm.BLAKE2B: return Hash.blake2b(arr);
-            case Hash.Algorithm.SHA256: return Hash.sha256(arr);
+            case Hash.Algorithm.BLAKE2B:
+                if (depth === 1) return Hash.blake2b(arr);
+                break;
+            case Hash.Algorithm.SHA256:
+                if (depth === 1) return Hash.sha256(arr);
+                break;
             // Hash.Algorithm.SHA512 postponed until hard-fork
             // Hash.Algorithm.ARGON2 intentionally omitted
             default: throw new Error('Invalid hash algorithm');
         }
+        if (!NumberUtils.isUint8(depth) || depth === 0) throw new Error('Invalid hash depth');
+        return new Hash(Hash.computeChain(arr, algorithm, depth), algorithm);
     }
 
     /**
@@ -217,6 +224,70 @@ class Hash extends Serializable {
         return size;
     }
 
+    /**
+     * Applies the hash function of the given algorithm depth times to input,
+     * which must be a digest of that algorithm, e.g. an HTLC pre-image.
+     * Argon2d chains are only supported synchronously on NodeJS, use computeChainAsync otherwise.
+     * @param {Uint8Array} input
+     * @param {Hash.Algorithm} algorithm
+     * @param {number} depth
+     * @returns {Uint8Array}
+     */
+    static computeChain(input, algorithm, depth) {
+        const hashSize = Hash.getSize(algorithm);
+        if (input.length !== hashSize) throw new Error('Invalid hash chain input');
+        if (PlatformUtils.isNodeJs()) {
+            const out = new Uint8Array(hashSize);
+            const res = NodeNative.node_hash_chain(out, new Uint8Array(input), algorithm, depth);
+            if (res !== 0) {
+                throw res;
+            }
+            return out;
+        } else {
+            let out = input;
+            for (let i = 0; i < depth; ++i) {
+                switch (algorithm) {
+                    case Hash.Algorithm.BLAKE2B: out = Hash.computeBlake2b(out); break;
+                    case Hash.Algorithm.SHA256: out = Hash.computeSha256(out); break;
+                    case Hash.Algorithm.SHA512: out = Hash.computeSha512(out); break;
+                    default: throw new Error('Invalid hash algorithm');
+                }
+            }
+            return new Uint8Array(out);
+        }
+    }
+
+    /**
+     * Like computeChain, but does not block the main thread on NodeJS and supports Argon2d on all platforms.
+     * @param {Uint8Array} input
+     * @param {Hash.Algorithm} algorithm
+     * @param {number} depth
+     * @returns {Promise.<Uint8Array>}
+     */
+    static async computeChainAsync(input, algorithm, depth) {
+        const hashSize = Hash.getSize(algorithm);
+        if (input.length !== hashSize) throw new Error('Invalid hash chain input');
+        if (PlatformUtils.isNodeJs()) {
+            const out = new Uint8Array(hashSize);
+            const res = await new Promise((resolve) => {
+                NodeNative.node_hash_chain_async(resolve, out, new Uint8Array(input), algorithm, depth);
+            });
+            if (res !== 0) {
+                throw res;
+            }
+            return out;
+        } else if (algorithm === Hash.Algorithm.ARGON2D) {
+            const worker = await CryptoWorker.getInstanceAsync();
+            let out = new Uint8Array(input);
+            for (let i = 0; i < depth; ++i) {
+                out = await worker.computeArgon2d(out);
+            }
+            return out;
+        } else {
+            return Hash.computeChain(input, algorithm, depth);
+        }
+    }
+
     /**
      * @param {Uint8Array} input
      * @returns {Uint8Array}
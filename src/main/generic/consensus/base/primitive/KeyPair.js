@@ -31,6 +31,90 @@ class KeyPair extends Serializable {
         return new KeyPair(privateKey, PublicKey.derive(privateKey));
     }
 
+    /**
+     * Generates privateKeys.length / PrivateKey.SIZE key pairs into caller-provided contiguous buffers: the private
+     * keys into privateKeys and, if given, the public keys and addresses into publicKeys and addresses. In NodeJS,
+     * the private keys come from the CSPRNG of the operating system and are derived natively in batches, without
+     * creating objects per key.
+     * @param {Uint8Array} privateKeys
+     * @param {?Uint8Array} [publicKeys]
+     * @param {?Uint8Array} [addresses]
+     */
+    static generateMany(privateKeys, publicKeys = null, addresses = null) {
+        const count = KeyPair._generateManyCount(privateKeys, publicKeys, addresses);
+        if (!PlatformUtils.isNodeJs()) {
+            KeyPair._generateManyFallback(privateKeys, publicKeys, addresses, count);
+            return;
+        }
+
+        NodeNative.node_ed25519_key_pairs_generate(privateKeys, publicKeys, addresses);
+    }
+
+    /**
+     * Same as generateMany, but in NodeJS the buffers are split into threads chunks that are generated in parallel
+     * on the native thread pool.
+     * @param {Uint8Array} privateKeys
+     * @param {?Uint8Array} [publicKeys]
+     * @param {?Uint8Array} [addresses]
+     * @param {number} [threads]
+     * @return {Promise}
+     */
+    static async generateManyAsync(privateKeys, publicKeys = null, addresses = null, threads = NativeUtils.THREADS) {
+        const count = KeyPair._generateManyCount(privateKeys, publicKeys, addresses);
+        if (!PlatformUtils.isNodeJs()) {
+            KeyPair._generateManyFallback(privateKeys, publicKeys, addresses, count);
+            return;
+        }
+
+        await NativeUtils.mapChunks(count, threads, (start, end) => {
+            const keys = privateKeys.subarray(start * PrivateKey.SIZE, end * PrivateKey.SIZE);
+            const pubs = publicKeys ? publicKeys.subarray(start * PublicKey.SIZE, end * PublicKey.SIZE) : null;
+            const addrs = addresses ? addresses.subarray(start * Address.SERIALIZED_SIZE, end * Address.SERIALIZED_SIZE) : null;
+            return new Promise((resolve, reject) => {
+                NodeNative.node_ed25519_key_pairs_generate_async(res => {
+                    if (res !== 0) reject(new Error('Failed to obtain randomness from the operating system'));
+                    else resolve();
+                }, keys, pubs, addrs);
+            });
+        });
+    }
+
+    /**
+     * @param {Uint8Array} privateKeys
+     * @param {?Uint8Array} publicKeys
+     * @param {?Uint8Array} addresses
+     * @return {number}
+     * @private
+     */
+    static _generateManyCount(privateKeys, publicKeys, addresses) {
+        if (!(privateKeys instanceof Uint8Array)) throw new Error('Primitive: Invalid type');
+        if (privateKeys.length % PrivateKey.SIZE !== 0) throw new Error('Primitive: Invalid length');
+        const count = privateKeys.length / PrivateKey.SIZE;
+        if (publicKeys && (!(publicKeys instanceof Uint8Array) || publicKeys.length < count * PublicKey.SIZE)) throw new Error('Primitive: Invalid length');
+        if (addresses && (!(addresses instanceof Uint8Array) || addresses.length < count * Address.SERIALIZED_SIZE)) throw new Error('Primitive: Invalid length');
+        return count;
+    }
+
+    /**
+     * @param {Uint8Array} privateKeys
+     * @param {?Uint8Array} publicKeys
+     * @param {?Uint8Array} addresses
+     * @param {number} count
+     * @private
+     */
+    static _generateManyFallback(privateKeys, publicKeys, addresses, count) {
+        // getRandomValues() provides at most 65536 bytes per call.
+        for (let offset = 0; offset < privateKeys.length; offset += 65536) {
+            CryptoWorker.lib.getRandomValues(privateKeys.subarray(offset, offset + 65536));
+        }
+        if (!publicKeys && !addresses) return;
+        for (let i = 0; i < count; i++) {
+            const publicKey = PublicKey.derive(new PrivateKey(privateKeys.subarray(i * PrivateKey.SIZE, (i + 1) * PrivateKey.SIZE)));
+            if (publicKeys) publicKeys.set(publicKey.serialize(), i * PublicKey.SIZE);
+            if (addresses) addresses.set(publicKey.toAddress().serialize(), i * Address.SERIALIZED_SIZE);
+        }
+    }
+
     /**
      * @param {PrivateKey} privateKey
      * @return {KeyPair}
@@ -0,0 +1,130 @@
+/**
+ * The delinearized multisig of a fixed set of cosigners, set up once for creating partial signatures for many
+ * messages. Natively, the public keys hash, the delinearization scalars of all cosigners, the aggregate public key
+ * and the delinearized private key of the signer are computed once and reused, for signing as well as for verifying
+ * the partial signatures of the cosigners.
+ */
+class MultiSigContext {
+    /**
+     * @param {Array.<PublicKey>} publicKeys
+     * @param {PrivateKey} [privateKey]
+     * @param {PublicKey} [publicKey] The public key of privateKey, required with privateKey
+     */
+    constructor(publicKeys, privateKey, publicKey) {
+        if (!Array.isArray(publicKeys) || publicKeys.length === 0) throw new Error('Primitive: Invalid type');
+        if (privateKey && !(publicKey instanceof PublicKey)) throw new Error('Primitive: Invalid type');
+
+        // Sort public keys to get the right combined public key.
+        publicKeys = publicKeys.slice();
+        publicKeys.sort((a, b) => a.compare(b));
+
+        /** @type {Array.<PublicKey>} */
+        this._publicKeys = publicKeys;
+        /** @type {?PrivateKey} */
+        this._privateKey = privateKey ? new PrivateKey(privateKey.serialize()) : null;
+        /** @type {?PublicKey} */
+        this._publicKey = privateKey ? publicKey : null;
+
+        if (PlatformUtils.isNodeJs()) {
+            const concatenatedPublicKeys = new Uint8Array(publicKeys.length * PublicKey.SIZE);
+            for (let i = 0; i < publicKeys.length; ++i) {
+                concatenatedPublicKeys.set(publicKeys[i].serialize(), i * PublicKey.SIZE);
+            }
+            /** @type {Uint8Array} */
+            this._context = new Uint8Array(NodeNative.ED25519_MULTISIG_CONTEXT_SIZE
+                + publicKeys.length * NodeNative.ED25519_MULTISIG_COSIGNER_SIZE);
+            const aggregatePublicKey = new Uint8Array(PublicKey.SIZE);
+            const valid = privateKey
+                ? NodeNative.node_ed25519_multisig_context_init(this._context, aggregatePublicKey, concatenatedPublicKeys,
+                    new Uint8Array(publicKey.serialize()), new Uint8Array(privateKey.serialize()))
+                : NodeNative.node_ed25519_multisig_context_init(this._context, aggregatePublicKey, concatenatedPublicKeys);
+            if (valid !== 1) throw new Error('Primitive: Invalid public key');
+            /** @type {PublicKey} */
+            this._aggregatePublicKey = new PublicKey(aggregatePublicKey);
+        } else {
+            /** @type {PublicKey} */
+            this._aggregatePublicKey = PublicKey._delinearizeAndAggregatePublicKeys(publicKeys);
+        }
+    }
+
+    /** @type {Array.<PublicKey>} */
+    get publicKeys() {
+        return this._publicKeys;
+    }
+
+    /** @type {PublicKey} */
+    get aggregatePublicKey() {
+        return this._aggregatePublicKey;
+    }
+
+    /**
+     * @param {RandomSecret} secret
+     * @param {Commitment} aggregateCommitment
+     * @param {Uint8Array} data
+     * @return {PartialSignature}
+     */
+    partialSign(secret, aggregateCommitment, data) {
+        if (!this._privateKey) throw new Error('MultiSigContext has no private key');
+        if (PlatformUtils.isNodeJs()) {
+            const out = new Uint8Array(PartialSignature.SIZE);
+            NodeNative.node_ed25519_multisig_partial_sign(out, new Uint8Array(data),
+                new Uint8Array(aggregateCommitment.serialize()), new Uint8Array(secret.serialize()), this._context);
+            return new PartialSignature(out);
+        } else {
+            return PartialSignature.create(this._privateKey, this._publicKey, this._publicKeys, secret,
+                aggregateCommitment, data);
+        }
+    }
+
+    /**
+     * Verifies the partial signature of the cosigner publicKey against its own commitment, using the delinearization
+     * scalar and the decoded public key cached for the cosigner. Only available in NodeJS.
+     * @param {PublicKey} publicKey
+     * @param {PartialSignature} partialSignature
+     * @param {Commitment} commitment The commitment of the cosigner
+     * @param {Commitment} aggregateCommitment
+     * @param {Uint8Array} data
+     * @return {boolean}
+     */
+    verifyPartialSignature(publicKey, partialSignature, commitment, aggregateCommitment, data) {
+        if (!PlatformUtils.isNodeJs()) throw new Error('Partial signature verification is only supported in NodeJS');
+        const index = this._publicKeys.findIndex(key => key.equals(publicKey));
+        if (index < 0) return false;
+        return NodeNative.node_ed25519_multisig_verify_partial(new Uint8Array(partialSignature.serialize()),
+            new Uint8Array(commitment.serialize()), new Uint8Array(data),
+            new Uint8Array(aggregateCommitment.serialize()), index, this._context) === 1;
+    }
+
+    /**
+     * Verifies the partial signatures of all cosigners in one batch, each exactly like verifyPartialSignature().
+     * Only available in NodeJS.
+     * @param {Array.<PartialSignature>} partialSignatures In the order of publicKeys
+     * @param {Array.<Commitment>} commitments In the order of publicKeys
+     * @param {Commitment} aggregateCommitment
+     * @param {Uint8Array} data
+     * @return {Array.<boolean>}
+     */
+    verifyPartialSignatures(partialSignatures, commitments, aggregateCommitment, data) {
+        if (!PlatformUtils.isNodeJs()) throw new Error('Partial signature verification is only supported in NodeJS');
+        const count = this._publicKeys.length;
+        if (partialSignatures.length !== count || commitments.length !== count) {
+            throw new Error('Batch length mismatch');
+        }
+
+        const partialSignatureBuffer = new Uint8Array(count * PartialSignature.SIZE);
+        const commitmentBuffer = new Uint8Array(count * Commitment.SIZE);
+        for (let i = 0; i < count; ++i) {
+            partialSignatureBuffer.set(partialSignatures[i].serialize(), i * PartialSignature.SIZE);
+            commitmentBuffer.set(commitments[i].serialize(), i * Commitment.SIZE);
+        }
+        const valid = new Uint8Array(count);
+        const randomness = new Uint8Array(32);
+        CryptoWorker.lib.getRandomValues(randomness);
+
+        NodeNative.node_ed25519_multisig_verify_partials(valid, partialSignatureBuffer, commitmentBuffer,
+            new Uint8Array(data), new Uint8Array(aggregateCommitment.serialize()), this._context, randomness);
+        return Array.from(valid, v => v === 1);
+    }
+}
+
+Class.register(MultiSigContext);
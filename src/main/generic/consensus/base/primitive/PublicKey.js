@@ -27,6 +27,70 @@ class PublicKey extends Serializable {
         return new PublicKey(PublicKey._publicKeyDerive(privateKey._obj));
     }
 
+    /**
+     * Derives the public keys of all of privateKeys. In NodeJS, the points of a batch are compressed with a single
+     * field inversion.
+     * @param {Array.<PrivateKey>} privateKeys
+     * @return {Array.<PublicKey>}
+     */
+    static deriveMany(privateKeys) {
+        if (!PlatformUtils.isNodeJs()) {
+            return privateKeys.map(privateKey => PublicKey.derive(privateKey));
+        }
+
+        const publicKeys = new Uint8Array(privateKeys.length * PublicKey.SIZE);
+        NodeNative.node_ed25519_public_keys_derive(publicKeys, null, PublicKey._privateKeyBuffer(privateKeys, 0, privateKeys.length));
+        const result = [];
+        for (let i = 0; i < privateKeys.length; i++) {
+            result.push(new PublicKey(publicKeys.slice(i * PublicKey.SIZE, (i + 1) * PublicKey.SIZE)));
+        }
+        return result;
+    }
+
+    /**
+     * Derives the addresses of all of privateKeys without creating their public keys. In NodeJS, the keys are split
+     * into threads chunks that are derived in parallel on the native thread pool.
+     * @param {Array.<PrivateKey>} privateKeys
+     * @param {number} [threads]
+     * @return {Promise.<Array.<Address>>}
+     */
+    static async deriveAddressesAsync(privateKeys, threads = NativeUtils.THREADS) {
+        if (!PlatformUtils.isNodeJs()) {
+            return privateKeys.map(privateKey => PublicKey.derive(privateKey).toAddress());
+        }
+
+        const chunks = await NativeUtils.mapChunks(privateKeys.length, threads, (start, end) => {
+            const addresses = new Uint8Array((end - start) * Address.SERIALIZED_SIZE);
+            const keys = PublicKey._privateKeyBuffer(privateKeys, start, end);
+            return new Promise(resolve => {
+                NodeNative.node_ed25519_public_keys_derive_async(resolve, null, addresses, keys);
+            }).then(() => {
+                const result = [];
+                for (let offset = 0; offset < addresses.length; offset += Address.SERIALIZED_SIZE) {
+                    result.push(new Address(addresses.slice(offset, offset + Address.SERIALIZED_SIZE)));
+                }
+                return result;
+            });
+        });
+
+        return [].concat(...chunks);
+    }
+
+    /**
+     * @param {Array.<PrivateKey>} privateKeys
+     * @param {number} start
+     * @param {number} end
+     * @return {Uint8Array}
+     * @private
+     */
+    static _privateKeyBuffer(privateKeys, start, end) {
+        const buffer = new Uint8Array((end - start) * PrivateKey.SIZE);
+        for (let i = start; i < end; i++) {
+            buffer.set(privateKeys[i].serialize(), (i - start) * PrivateKey.SIZE);
+        }
+        return buffer;
+    }
+
     /**
      * @param {Array.<PublicKey>} publicKeys
      * @return {PublicKey}
@@ -37,6 +101,18 @@ class PublicKey extends Serializable {
         return PublicKey._delinearizeAndAggregatePublicKeys(publicKeys);
     }
 
+    /**
+     * Hit and miss counts of the native cache of decompressed public keys used by signature verification.
+     * Always zero outside of NodeJS.
+     * @return {{hits: number, misses: number}}
+     */
+    static getCacheStats() {
+        if (PlatformUtils.isNodeJs()) {
+            return NodeNative.node_ed25519_key_cache_stats();
+        }
+        return {hits: 0, misses: 0};
+    }
+
     /**
      * @param {SerialBuffer} buf
      * @return {PublicKey}
@@ -208,7 +284,9 @@ class PublicKey extends Serializable {
         }
         if (PlatformUtils.isNodeJs()) {
             const out = new Uint8Array(PublicKey.SIZE);
-            NodeNative.node_ed25519_delinearize_public_key(out, new Uint8Array(publicKeysHash), new Uint8Array(publicKey));
+            if (NodeNative.node_ed25519_delinearize_public_key(out, new Uint8Array(publicKeysHash), new Uint8Array(publicKey)) !== 1) {
+                throw new Error('Primitive: Invalid public key');
+            }
             return out;
         } else {
             let stackPtr;
@@ -219,6 +297,7 @@ class PublicKey extends Serializable {
                 const wasmInPublicKeysHash = Module.stackAlloc(publicKeysHash.length);
                 new Uint8Array(Module.HEAPU8.buffer, wasmInPublicKey, publicKey.length).set(publicKey);
                 new Uint8Array(Module.HEAPU8.buffer, wasmInPublicKeysHash, publicKeysHash.length).set(publicKeysHash);
+                // The shipped wasm predates the result of ed25519_delinearize_public_key, so it is not checked here.
                 Module._ed25519_delinearize_public_key(wasmOut, wasmInPublicKeysHash, wasmInPublicKey);
                 const delinearizedPublicKey = new Uint8Array(PublicKey.SIZE);
                 delinearizedPublicKey.set(new Uint8Array(Module.HEAPU8.buffer, wasmOut, PublicKey.SIZE));
@@ -248,7 +327,9 @@ class PublicKey extends Serializable {
         }
         if (PlatformUtils.isNodeJs()) {
             const out = new Uint8Array(PublicKey.SIZE);
-            NodeNative.node_ed25519_aggregate_delinearized_public_keys(out, new Uint8Array(publicKeysHash), concatenatedPublicKeys, publicKeys.length);
+            if (NodeNative.node_ed25519_aggregate_delinearized_public_keys(out, new Uint8Array(publicKeysHash), concatenatedPublicKeys, publicKeys.length) !== 1) {
+                throw new Error('Primitive: Invalid public key');
+            }
             return out;
         } else {
             let stackPtr;
@@ -259,6 +340,7 @@ class PublicKey extends Serializable {
                 const wasmInPublicKeysHash = Module.stackAlloc(publicKeysHash.length);
                 new Uint8Array(Module.HEAPU8.buffer, wasmInPublicKeys, concatenatedPublicKeys.length).set(concatenatedPublicKeys);
                 new Uint8Array(Module.HEAPU8.buffer, wasmInPublicKeysHash, publicKeysHash.length).set(publicKeysHash);
+                // The shipped wasm predates the result of ed25519_aggregate_delinearized_public_keys, so it is not checked here.
                 Module._ed25519_aggregate_delinearized_public_keys(wasmOut, wasmInPublicKeysHash, wasmInPublicKeys, publicKeys.length);
                 const aggregatePublicKey = new Uint8Array(PublicKey.SIZE);
                 aggregatePublicKey.set(new Uint8Array(Module.HEAPU8.buffer, wasmOut, PublicKey.SIZE));
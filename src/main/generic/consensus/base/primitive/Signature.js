@@ -87,6 +87,106 @@ class Signature extends Serializable {
         return Signature._signatureVerify(publicKey._obj, data, this._obj);
     }
 
+    /**
+     * Verifies signatures[i] of data[i] by publicKeys[i] for all i. In NodeJS the signatures are checked
+     * together with a random linear combination, and only chunks that fail are checked one by one.
+     * Like any batch verification, this may accept a signature that was crafted with small order
+     * components and that verify() rejects, so use verify() where the results have to match exactly.
+     * @param {Array.<Signature>} signatures
+     * @param {Array.<PublicKey>} publicKeys
+     * @param {Array.<Uint8Array>} data
+     * @return {Array.<boolean>}
+     */
+    static verifyBatch(signatures, publicKeys, data) {
+        if (signatures.length !== publicKeys.length || signatures.length !== data.length) {
+            throw new Error('Batch length mismatch');
+        }
+        if (!PlatformUtils.isNodeJs()) {
+            return signatures.map((signature, i) => signature.verify(publicKeys[i], data[i]));
+        }
+
+        const {signatureBuffer, messages, lens, publicKeyBuffer} = Signature._batchBuffers(signatures, publicKeys, data, 0, signatures.length);
+        const valid = new Uint8Array(signatures.length);
+        const randomness = new Uint8Array(32);
+        CryptoWorker.lib.getRandomValues(randomness);
+
+        NodeNative.node_ed25519_verify_batch(valid, signatureBuffer, messages, lens, publicKeyBuffer, randomness);
+        return Array.from(valid, v => v === 1);
+    }
+
+    /**
+     * Verifies signatures[i] of data[i] by publicKeys[i] for all i, each exactly like verify().
+     * In NodeJS the signatures are split into threads chunks that are checked in parallel on the native thread pool.
+     * @param {Array.<Signature>} signatures
+     * @param {Array.<PublicKey>} publicKeys
+     * @param {Array.<Uint8Array>} data
+     * @param {number} [threads]
+     * @return {Promise.<Array.<boolean>>}
+     */
+    static async verifyManyAsync(signatures, publicKeys, data, threads = NativeUtils.THREADS) {
+        if (signatures.length !== publicKeys.length || signatures.length !== data.length) {
+            throw new Error('Batch length mismatch');
+        }
+        if (!PlatformUtils.isNodeJs()) {
+            return signatures.map((signature, i) => signature.verify(publicKeys[i], data[i]));
+        }
+
+        const chunks = await NativeUtils.mapChunks(signatures.length, threads, (start, end) => {
+            const {signatureBuffer, messages, lens, publicKeyBuffer} = Signature._batchBuffers(signatures, publicKeys, data, start, end);
+            const valid = new Uint8Array(end - start);
+            return new Promise(resolve => {
+                NodeNative.node_ed25519_verify_many_async(resolve, valid, signatureBuffer, messages, lens, publicKeyBuffer);
+            }).then(() => valid);
+        });
+
+        const result = [];
+        for (const valid of chunks) {
+            for (const v of valid) result.push(v === 1);
+        }
+        return result;
+    }
+
+    /**
+     * Hit and miss counts of the native cache of verified signatures, which lets verify() and verifyManyAsync() skip
+     * signatures that were checked before, e.g. at mempool admission and again in a block. Always zero outside of NodeJS.
+     * @return {{hits: number, misses: number}}
+     */
+    static getCacheStats() {
+        if (PlatformUtils.isNodeJs()) {
+            return NodeNative.node_ed25519_signature_cache_stats();
+        }
+        return {hits: 0, misses: 0};
+    }
+
+    /**
+     * Packs signatures, public keys and data of the range start ... end - 1 into flat buffers for the native bindings.
+     * @param {Array.<Signature>} signatures
+     * @param {Array.<PublicKey>} publicKeys
+     * @param {Array.<Uint8Array>} data
+     * @param {number} start
+     * @param {number} end
+     * @return {{signatureBuffer: Uint8Array, messages: Uint8Array, lens: Uint32Array, publicKeyBuffer: Uint8Array}}
+     * @private
+     */
+    static _batchBuffers(signatures, publicKeys, data, start, end) {
+        const count = end - start;
+        const lens = new Uint32Array(count);
+        const signatureBuffer = new Uint8Array(count * Signature.SIZE);
+        const publicKeyBuffer = new Uint8Array(count * PublicKey.SIZE);
+        let totalLength = 0;
+        for (let i = 0; i < count; i++) {
+            signatureBuffer.set(signatures[start + i]._obj, i * Signature.SIZE);
+            publicKeyBuffer.set(publicKeys[start + i]._obj, i * PublicKey.SIZE);
+            lens[i] = data[start + i].length;
+            totalLength += lens[i];
+        }
+        const messages = new Uint8Array(totalLength);
+        for (let i = 0, offset = 0; i < count; offset += lens[i++]) {
+            messages.set(data[start + i], offset);
+        }
+        return {signatureBuffer, messages, lens, publicKeyBuffer};
+    }
+
     /**
      * @param {Serializable} o
      * @return {boolean}
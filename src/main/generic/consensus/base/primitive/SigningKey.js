@@ -0,0 +1,121 @@
+/**
+ * A private key prepared for signing many messages. Natively, the key is expanded once
+ * (the hash of the private key, the nonce prefix hash state and the public key) and
+ * reused for every signature instead of being recomputed per message.
+ */
+class SigningKey {
+    /**
+     * @param {PrivateKey} privateKey
+     */
+    constructor(privateKey) {
+        if (!(privateKey instanceof PrivateKey)) throw new Error('Primitive: Invalid type');
+        if (PlatformUtils.isNodeJs()) {
+            const publicKey = new Uint8Array(PublicKey.SIZE);
+            /** @type {Uint8Array} */
+            this._context = new Uint8Array(NodeNative.ED25519_EXPANDED_KEY_SIZE);
+            NodeNative.node_ed25519_expand_key(this._context, publicKey, new Uint8Array(privateKey.serialize()));
+            /** @type {PublicKey} */
+            this._publicKey = new PublicKey(publicKey);
+        } else {
+            /** @type {PrivateKey} */
+            this._privateKey = new PrivateKey(privateKey.serialize());
+            /** @type {PublicKey} */
+            this._publicKey = PublicKey.derive(privateKey);
+        }
+    }
+
+    /** @type {PublicKey} */
+    get publicKey() {
+        return this._publicKey;
+    }
+
+    /**
+     * @param {Uint8Array} data
+     * @return {Signature}
+     */
+    sign(data) {
+        if (PlatformUtils.isNodeJs()) {
+            const out = new Uint8Array(Signature.SIZE);
+            NodeNative.node_ed25519_sign_expanded(out, new Uint8Array(data), this._context);
+            return new Signature(out);
+        } else {
+            return Signature.create(this._privateKey, this._publicKey, data);
+        }
+    }
+
+    /**
+     * Signs all of data in one native call.
+     * @param {Array.<Uint8Array>} data
+     * @return {Array.<Signature>}
+     */
+    signMany(data) {
+        if (!PlatformUtils.isNodeJs()) {
+            return data.map(d => this.sign(d));
+        }
+
+        const {messages, lens} = SigningKey._messageBuffers(data, 0, data.length);
+        const signatures = new Uint8Array(data.length * Signature.SIZE);
+        NodeNative.node_ed25519_sign_many(signatures, messages, lens, this._context);
+        return SigningKey._splitSignatures(signatures);
+    }
+
+    /**
+     * Signs all of data. In NodeJS the messages are split into threads chunks that are signed in parallel on the
+     * native thread pool.
+     * @param {Array.<Uint8Array>} data
+     * @param {number} [threads]
+     * @return {Promise.<Array.<Signature>>}
+     */
+    async signManyAsync(data, threads = NativeUtils.THREADS) {
+        if (!PlatformUtils.isNodeJs()) {
+            return this.signMany(data);
+        }
+
+        const chunks = await NativeUtils.mapChunks(data.length, threads, (start, end) => {
+            const {messages, lens} = SigningKey._messageBuffers(data, start, end);
+            const signatures = new Uint8Array((end - start) * Signature.SIZE);
+            return new Promise(resolve => {
+                NodeNative.node_ed25519_sign_many_async(resolve, signatures, messages, lens, this._context);
+            }).then(() => SigningKey._splitSignatures(signatures));
+        });
+
+        return [].concat(...chunks);
+    }
+
+    /**
+     * Packs the messages of the range start ... end - 1 back to back for the native bindings.
+     * @param {Array.<Uint8Array>} data
+     * @param {number} start
+     * @param {number} end
+     * @return {{messages: Uint8Array, lens: Uint32Array}}
+     * @private
+     */
+    static _messageBuffers(data, start, end) {
+        const lens = new Uint32Array(end - start);
+        let totalLength = 0;
+        for (let i = 0; i < lens.length; i++) {
+            lens[i] = data[start + i].length;
+            totalLength += lens[i];
+        }
+        const messages = new Uint8Array(totalLength);
+        for (let i = 0, offset = 0; i < lens.length; offset += lens[i++]) {
+            messages.set(data[start + i], offset);
+        }
+        return {messages, lens};
+    }
+
+    /**
+     * @param {Uint8Array} signatures
+     * @return {Array.<Signature>}
+     * @private
+     */
+    static _splitSignatures(signatures) {
+        const result = [];
+        for (let offset = 0; offset < signatures.length; offset += Signature.SIZE) {
+            result.push(new Signature(signatures.slice(offset, offset + Signature.SIZE)));
+        }
+        return result;
+    }
+}
+
+Class.register(SigningKey);
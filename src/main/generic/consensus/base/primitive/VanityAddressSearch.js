@@ -0,0 +1,143 @@
+class VanityAddressSearch {
+    /**
+     * Searches for key pairs whose user-friendly address (without the NQ and check digits)
+     * starts or, if suffix is set, ends with the given pattern.
+     * @param {string} pattern
+     * @param {boolean} [suffix]
+     */
+    constructor(pattern, suffix = false) {
+        pattern = pattern.replace(/ /g, '').toUpperCase();
+        if (pattern.length === 0 || pattern.length > VanityAddressSearch.ADDRESS_CHARS) throw new Error('Invalid pattern length');
+
+        const alphabet = BufferUtils.BASE32_ALPHABET.NIMIQ;
+        this._values = new Uint8Array(pattern.length);
+        for (let i = 0; i < pattern.length; i++) {
+            const value = alphabet.indexOf(pattern[i]);
+            if (value < 0) throw new Error(`Invalid pattern character ${pattern[i]}`);
+            this._values[i] = value;
+        }
+
+        /** @type {string} */
+        this._pattern = pattern;
+        /** @type {boolean} */
+        this._suffix = suffix;
+        /** @type {number} */
+        this._candidates = 0;
+        /** @type {boolean} */
+        this._running = false;
+    }
+
+    /**
+     * Searches until count matches are found or stop() is called. In NodeJS the search runs
+     * natively in threads parallel loops on the libuv thread pool.
+     * @param {number} [count]
+     * @param {number} [threads]
+     * @return {Promise.<Array.<KeyPair>>}
+     */
+    async find(count = 1, threads = NativeUtils.THREADS) {
+        if (this._running) throw new Error('Search already running');
+        this._running = true;
+        /** @type {Array.<KeyPair>} */
+        const matches = [];
+        try {
+            if (PlatformUtils.isNodeJs()) {
+                const workers = [];
+                for (let i = 0; i < threads; i++) {
+                    workers.push(this._runNative(matches, count));
+                }
+                await Promise.all(workers);
+            } else {
+                await this._runJs(matches, count);
+            }
+        } finally {
+            this._running = false;
+        }
+        return matches.slice(0, count);
+    }
+
+    /**
+     * @param {Array.<KeyPair>} matches
+     * @param {number} count
+     * @return {Promise}
+     * @private
+     */
+    async _runNative(matches, count) {
+        const mode = this._suffix ? VanityAddressSearch.MATCH_SUFFIX : VanityAddressSearch.MATCH_PREFIX;
+        const out = new Uint8Array(count * PrivateKey.SIZE);
+        while (this._running && matches.length < count) {
+            // Every chunk gets a fresh random generator key, so chunks never test the same candidates.
+            const key = new Uint8Array(VanityAddressSearch.KEY_SIZE);
+            CryptoWorker.lib.getRandomValues(key);
+            const found = await new Promise(resolve => {
+                NodeNative.node_vanity_search_async(resolve, out, key, 0, VanityAddressSearch.CHUNK_SIZE, this._values, mode);
+            });
+            this._candidates += VanityAddressSearch.CHUNK_SIZE;
+            for (let i = 0; i < Math.min(found, count); i++) {
+                matches.push(KeyPair.derive(new PrivateKey(out.slice(i * PrivateKey.SIZE, (i + 1) * PrivateKey.SIZE))));
+            }
+        }
+    }
+
+    /**
+     * @param {Array.<KeyPair>} matches
+     * @param {number} count
+     * @return {Promise}
+     * @private
+     */
+    async _runJs(matches, count) {
+        while (this._running && matches.length < count) {
+            for (let i = 0; i < VanityAddressSearch.JS_CHUNK_SIZE; i++) {
+                const keyPair = KeyPair.derive(PrivateKey.generate());
+                if (this.matches(keyPair.publicKey.toAddress())) matches.push(keyPair);
+            }
+            this._candidates += VanityAddressSearch.JS_CHUNK_SIZE;
+            // Yield to the event loop between chunks.
+            await new Promise(resolve => setTimeout(resolve, 0));
+        }
+    }
+
+    /**
+     * Stops a running search. The pending find() resolves with the matches found so far.
+     */
+    stop() {
+        this._running = false;
+    }
+
+    /**
+     * @param {Address} address
+     * @return {boolean}
+     */
+    matches(address) {
+        const chars = address.toUserFriendlyAddress(false).substr(4);
+        return this._suffix ? chars.endsWith(this._pattern) : chars.startsWith(this._pattern);
+    }
+
+    /** @type {string} */
+    get pattern() {
+        return this._pattern;
+    }
+
+    /** @type {boolean} */
+    get suffix() {
+        return this._suffix;
+    }
+
+    /**
+     * Number of candidates tested so far.
+     * @type {number}
+     */
+    get candidates() {
+        return this._candidates;
+    }
+}
+
+VanityAddressSearch.KEY_SIZE = 32;
+VanityAddressSearch.ADDRESS_CHARS = 32;
+VanityAddressSearch.MATCH_PREFIX = 0;
+VanityAddressSearch.MATCH_SUFFIX = 1;
+/** Candidates per native call; about a fifth of a second on one core. */
+VanityAddressSearch.CHUNK_SIZE = 4096;
+/** Candidates per event loop turn in the JS fallback. */
+VanityAddressSearch.JS_CHUNK_SIZE = 64;
+
+Class.register(VanityAddressSearch);
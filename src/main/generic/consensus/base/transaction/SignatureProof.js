@@ -4,6 +4,15 @@ class SignatureProof {
      * @returns {boolean}
      */
     static verifyTransaction(transaction) {
+        if (PlatformUtils.isNodeJs()) {
+            // Reuse the result of verifyTransactionsAsync if the proof has not been replaced or modified since.
+            const verified = transaction._verifiedProof;
+            const result = verified && BufferUtils.equals(verified.proof, transaction.proof) ? verified.result
+                : NodeNative.node_signature_proof_verify(new Uint8Array(transaction.proof),
+                    new Uint8Array(transaction.sender.serialize()), new Uint8Array(transaction.serializeContent()));
+            return SignatureProof._checkNativeResult(result);
+        }
+
         try {
             const buffer = new SerialBuffer(transaction.proof);
             const proof = SignatureProof.unserialize(buffer);
@@ -21,6 +30,68 @@ class SignatureProof {
         }
     }
 
+    /**
+     * Verifies the SignatureProofs of transactions from basic accounts in parallel on the native thread pool, each in
+     * a single native call that checks the Merkle path against the sender address as well as the signature, and
+     * remembers the results on the transactions, so that verifyTransaction() does not check them again.
+     * Does nothing outside of NodeJS.
+     * @param {Array.<Transaction>} transactions
+     * @param {number} [threads]
+     * @returns {Promise}
+     */
+    static async verifyTransactionsAsync(transactions, threads = NativeUtils.THREADS) {
+        if (!PlatformUtils.isNodeJs()) return;
+
+        const pending = transactions.filter(tx => tx._valid === undefined && tx.senderType === Account.Type.BASIC);
+        await NativeUtils.mapChunks(pending.length, threads, (start, end) => {
+            const chunk = pending.slice(start, end);
+            const contents = chunk.map(tx => tx.serializeContent());
+            const proofLens = Uint32Array.from(chunk, tx => tx.proof.length);
+            const messageLens = Uint32Array.from(contents, content => content.length);
+            const proofs = new Uint8Array(proofLens.reduce((sum, len) => sum + len, 0));
+            const messages = new Uint8Array(messageLens.reduce((sum, len) => sum + len, 0));
+            const senders = new Uint8Array(chunk.length * Address.SERIALIZED_SIZE);
+            for (let i = 0, proofPos = 0, messagePos = 0; i < chunk.length; i++) {
+                proofs.set(chunk[i].proof, proofPos);
+                proofPos += proofLens[i];
+                messages.set(contents[i], messagePos);
+                messagePos += messageLens[i];
+                senders.set(chunk[i].sender.serialize(), i * Address.SERIALIZED_SIZE);
+            }
+
+            const results = new Uint8Array(chunk.length);
+            return new Promise(resolve => {
+                NodeNative.node_signature_proofs_verify_async(resolve, results, proofs, proofLens, senders, messages, messageLens);
+            }).then(() => {
+                // Remember the checked bytes rather than the proof itself, which may be modified in place.
+                for (let i = 0, proofPos = 0; i < chunk.length; proofPos += proofLens[i++]) {
+                    chunk[i]._verifiedProof = {proof: proofs.subarray(proofPos, proofPos + proofLens[i]), result: results[i]};
+                }
+            });
+        });
+    }
+
+    /**
+     * @param {number} result One of the SignatureProof.NativeResult values
+     * @returns {boolean}
+     * @private
+     */
+    static _checkNativeResult(result) {
+        switch (result) {
+            case SignatureProof.NativeResult.VALID:
+                return true;
+            case SignatureProof.NativeResult.MALFORMED:
+                Log.w(SignatureProof, 'Invalid SignatureProof - malformed');
+                return false;
+            case SignatureProof.NativeResult.WRONG_SIGNER:
+                Log.w(SignatureProof, 'Invalid SignatureProof - signer does not match sender address');
+                return false;
+            default:
+                Log.w(SignatureProof, 'Invalid SignatureProof - signature is invalid');
+                return false;
+        }
+    }
+
     /**
      * @param {PublicKey} publicKey
      * @param {Signature} signature
@@ -175,4 +246,11 @@ class SignatureProof {
     }
 }
 
+/** Results of the native SignatureProof verification, see nimiq_signature_proof_verify. */
+SignatureProof.NativeResult = {
+    VALID: 0,
+    MALFORMED: 1,
+    WRONG_SIGNER: 2,
+    INVALID_SIGNATURE: 3
+};
 Class.register(SignatureProof);
@@ -0,0 +1,33 @@
+class NativeUtils {
+    /**
+     * Number of chunks that batch operations split their work into in NodeJS, i.e., the size of the libuv thread
+     * pool that runs the asynchronous native bindings: UV_THREADPOOL_SIZE if set, libuv's default of 4 otherwise.
+     * @type {number}
+     */
+    static get THREADS() {
+        if (PlatformUtils.isNodeJs()) {
+            const size = parseInt(process.env.UV_THREADPOOL_SIZE, 10);
+            if (size > 0) return size;
+        }
+        return 4;
+    }
+
+    /**
+     * Splits the range 0 ... count - 1 into at most threads consecutive chunks of (almost) equal size and calls
+     * fn(start, end) for each of them, e.g., to run them in parallel on the native thread pool.
+     * @template T
+     * @param {number} count
+     * @param {number} threads
+     * @param {function(number, number):Promise.<T>} fn
+     * @return {Promise.<Array.<T>>} The results of fn for each chunk, in order
+     */
+    static mapChunks(count, threads, fn) {
+        const chunkSize = Math.max(1, Math.ceil(count / threads));
+        const chunks = [];
+        for (let start = 0; start < count; start += chunkSize) {
+            chunks.push(fn(start, Math.min(start + chunkSize, count)));
+        }
+        return Promise.all(chunks);
+    }
+}
+Class.register(NativeUtils);
@@ -5,20 +5,7 @@ class CryptoUtils {
      * @return {Uint8Array}
      */
     static computeHmacSha512(key, data) {
-        if (key.length > CryptoUtils.SHA512_BLOCK_SIZE) {
-            key = new SerialBuffer(Hash.computeSha512(key));
-        }
-
-        const iKey = new SerialBuffer(CryptoUtils.SHA512_BLOCK_SIZE);
-        const oKey = new SerialBuffer(CryptoUtils.SHA512_BLOCK_SIZE);
-        for (let i = 0; i < CryptoUtils.SHA512_BLOCK_SIZE; ++i) {
-            const byte = key[i] || 0;
-            iKey[i] = 0x36 ^ byte;
-            oKey[i] = 0x5c ^ byte;
-        }
-
-        const innerHash = Hash.computeSha512(BufferUtils.concatTypedArrays(iKey, data));
-        return Hash.computeSha512(BufferUtils.concatTypedArrays(oKey, innerHash));
+        return new HmacSha512(key).compute(data);
     }
 
     /**
@@ -36,19 +23,26 @@ class CryptoUtils {
             throw new Error('Derived key too long');
         }
 
+        if (PlatformUtils.isNodeJs()) {
+            const derivedKey = new SerialBuffer(derivedKeyLength);
+            NodeNative.node_pbkdf2_sha512(derivedKey, new Uint8Array(password), new Uint8Array(salt), iterations);
+            return derivedKey;
+        }
+
         const l = Math.ceil(derivedKeyLength / hashLength);
         const r = derivedKeyLength - (l - 1) * hashLength;
 
+        const hmac = new HmacSha512(password);
         const derivedKey = new SerialBuffer(derivedKeyLength);
         for (let i = 1; i <= l; i++) {
             let u = new SerialBuffer(salt.length + 4);
             u.write(salt);
             u.writeUint32(i);
 
-            u = CryptoUtils.computeHmacSha512(password, u);
+            u = hmac.compute(u);
             const t = u;
             for (let j = 1; j < iterations; j++) {
-                u = CryptoUtils.computeHmacSha512(password, u);
+                u = hmac.compute(u);
                 for (let k = 0; k < t.length; k++) {
                     t[k] ^= u[k];
                 }
@@ -63,6 +57,31 @@ class CryptoUtils {
         return derivedKey;
     }
 
+    /**
+     * Like computePBKDF2sha512, but runs on the native thread pool in NodeJS.
+     * @param {Uint8Array} password
+     * @param {Uint8Array} salt
+     * @param {number} iterations
+     * @param {number} derivedKeyLength
+     * @return {Promise.<SerialBuffer>}
+     */
+    static async computePBKDF2sha512Async(password, salt, iterations, derivedKeyLength) {
+        if (!PlatformUtils.isNodeJs()) {
+            return CryptoUtils.computePBKDF2sha512(password, salt, iterations, derivedKeyLength);
+        }
+
+        const hashLength = Hash.SIZE.get(Hash.Algorithm.SHA512);
+        if (derivedKeyLength > (Math.pow(2, 32) - 1) * hashLength) {
+            throw new Error('Derived key too long');
+        }
+
+        const derivedKey = new SerialBuffer(derivedKeyLength);
+        await new Promise(resolve => {
+            NodeNative.node_pbkdf2_sha512_async(resolve, derivedKey, new Uint8Array(password), new Uint8Array(salt), iterations);
+        });
+        return derivedKey;
+    }
+
     /**
      * @param {Uint8Array} message
      * @param {Uint8Array} key
@@ -0,0 +1,47 @@
+/**
+ * HMAC-SHA512 bound to a fixed key. The padded key blocks (natively, the hash
+ * states after absorbing them) are computed once and reused for every MAC.
+ */
+class HmacSha512 {
+    /**
+     * @param {Uint8Array} key
+     */
+    constructor(key) {
+        if (PlatformUtils.isNodeJs()) {
+            /** @type {Uint8Array} */
+            this._context = new Uint8Array(NodeNative.HMAC_SHA512_CONTEXT_SIZE);
+            NodeNative.node_hmac_sha512_init(this._context, new Uint8Array(key));
+        } else {
+            if (key.length > CryptoUtils.SHA512_BLOCK_SIZE) {
+                key = new SerialBuffer(Hash.computeSha512(key));
+            }
+
+            /** @type {Uint8Array} */
+            this._iKey = new Uint8Array(CryptoUtils.SHA512_BLOCK_SIZE);
+            /** @type {Uint8Array} */
+            this._oKey = new Uint8Array(CryptoUtils.SHA512_BLOCK_SIZE);
+            for (let i = 0; i < CryptoUtils.SHA512_BLOCK_SIZE; ++i) {
+                const byte = key[i] || 0;
+                this._iKey[i] = 0x36 ^ byte;
+                this._oKey[i] = 0x5c ^ byte;
+            }
+        }
+    }
+
+    /**
+     * @param {Uint8Array} data
+     * @return {Uint8Array}
+     */
+    compute(data) {
+        if (PlatformUtils.isNodeJs()) {
+            const out = new Uint8Array(Hash.getSize(Hash.Algorithm.SHA512));
+            NodeNative.node_hmac_sha512(out, this._context, new Uint8Array(data));
+            return out;
+        } else {
+            const innerHash = Hash.computeSha512(BufferUtils.concatTypedArrays(this._iKey, data));
+            return Hash.computeSha512(BufferUtils.concatTypedArrays(this._oKey, innerHash));
+        }
+    }
+}
+
+Class.register(HmacSha512);
@@ -198,6 +198,21 @@ class MnemonicUtils {
         return CryptoUtils.computePBKDF2sha512(mnemonicBuffer, saltBuffer, 2048, 64);
     }
 
+    /**
+     * Like mnemonicToSeed, but derives the seed on the native thread pool in NodeJS.
+     * @param {string|Array.<string>} mnemonic
+     * @param {string} [password]
+     * @returns {Promise.<SerialBuffer>}
+     */
+    static mnemonicToSeedAsync(mnemonic, password) {
+        if (Array.isArray(mnemonic)) mnemonic = mnemonic.join(' ');
+
+        const mnemonicBuffer = BufferUtils.fromAscii(mnemonic);
+        const saltBuffer = BufferUtils.fromAscii(MnemonicUtils._salt(password));
+
+        return CryptoUtils.computePBKDF2sha512Async(mnemonicBuffer, saltBuffer, 2048, 64);
+    }
+
     /**
      * @param {string|Array.<string>} mnemonic
      * @param {string} [password]
@@ -208,6 +223,16 @@ class MnemonicUtils {
         return ExtendedPrivateKey.generateMasterKey(seed);
     }
 
+    /**
+     * @param {string|Array.<string>} mnemonic
+     * @param {string} [password]
+     * @returns {Promise.<ExtendedPrivateKey>}
+     */
+    static async mnemonicToExtendedPrivateKeyAsync(mnemonic, password) {
+        const seed = await MnemonicUtils.mnemonicToSeedAsync(mnemonic, password);
+        return ExtendedPrivateKey.generateMasterKey(seed);
+    }
+
     /**
      * @param {Entropy} entropy
      * @returns {boolean}
@@ -0,0 +1,45 @@
+#include "cpu.h"
+
+#ifdef NIMIQ_CPU_X86
+#include <cpuid.h>
+
+static int nimiq_cpu_detect(void) {
+    unsigned int eax, ebx, ecx, edx;
+    unsigned int xcr0 = 0;
+    int features = 0;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+    if (ecx & (1 << 9)) features |= NIMIQ_CPU_SSSE3;
+    if (ecx & (1 << 19)) features |= NIMIQ_CPU_SSE41;
+    if (ecx & (1 << 27)) {
+        /* OSXSAVE: ask the OS which register states it saves on context switches */
+        unsigned int xcr0_hi;
+        __asm__ __volatile__("xgetbv" : "=a"(xcr0), "=d"(xcr0_hi) : "c"(0));
+        (void) xcr0_hi;
+    }
+    if ((ecx & (1 << 28)) && (xcr0 & 0x06) == 0x06) features |= NIMIQ_CPU_AVX;
+
+    if (__get_cpuid_max(0, 0) >= 7) {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        if ((ebx & (1 << 5)) && (features & NIMIQ_CPU_AVX)) features |= NIMIQ_CPU_AVX2;
+        if ((ebx & (1 << 16)) && (xcr0 & 0xe6) == 0xe6) features |= NIMIQ_CPU_AVX512F;
+        if (ebx & (1 << 29)) features |= NIMIQ_CPU_SHA;
+        if (ebx & (1 << 8)) features |= NIMIQ_CPU_BMI2;
+    }
+    return features;
+}
+#else
+static int nimiq_cpu_detect(void) {
+    return 0;
+}
+#endif
+
+/* Detection is idempotent, so racing threads at worst run it twice. */
+static int nimiq_cpu_features_cache = -1;
+
+int nimiq_cpu_features(void) {
+    if (nimiq_cpu_features_cache < 0) {
+        nimiq_cpu_features_cache = nimiq_cpu_detect();
+    }
+    return nimiq_cpu_features_cache;
+}
@@ -0,0 +1,26 @@
+#ifndef __NIMIQ_CPU_H
+#define __NIMIQ_CPU_H
+
+/*
+ * Runtime detection of optional instruction set extensions. Code using these
+ * must be compiled with the matching target attribute, since the generic
+ * builds do not enable the extensions globally.
+ * Define NIMIQ_NO_CPU_DISPATCH to build the portable code paths only.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(NIMIQ_NO_CPU_DISPATCH)
+    #define NIMIQ_CPU_X86
+#endif
+
+#define NIMIQ_CPU_SSSE3   (1 << 0)
+#define NIMIQ_CPU_SSE41   (1 << 1)
+#define NIMIQ_CPU_AVX     (1 << 2)
+#define NIMIQ_CPU_AVX2    (1 << 3)
+#define NIMIQ_CPU_AVX512F (1 << 4)
+#define NIMIQ_CPU_SHA     (1 << 5)
+#define NIMIQ_CPU_BMI2    (1 << 6)
+
+/* Returns a bitmask of NIMIQ_CPU_* flags supported by both the processor and the OS. */
+int nimiq_cpu_features(void);
+
+#endif
@@ -1,6 +1,9 @@
+#include <string.h>
+
 #include "ed25519.h"
 #include "sha512.h"
 #include "ge.h"
+#include "key_cache.h"
 #include "sc.h"
 
 /*
@@ -50,61 +53,105 @@ void ed25519_derive_delinearized_private_key(unsigned char *multisig_private_key
 
 /*
  * Let C = public_keys_hash = H(P_1 || ... || P_n).
- * Aggregates a set of public keys P_1, ..., P_n to P = ∑ H(C || P_i) P_i.
+ * Computes P = ∑ H(C || P_i) P_i as a multi-scalar multiplication over the
+ * decoded keys, GE_MULTI_SIZE keys at a time. The keys and their odd multiples
+ * come from the key cache, so each key is decoded at most once, and the keys
+ * missing from it are decoded together. If cosigners is
+ * not NULL, each P_i and H(C || P_i) mod l are stored there as well.
+ * Returns 1, or 0 without writing the aggregate if one of the keys is not a
+ * valid point.
  */
 
-void ed25519_aggregate_delinearized_public_keys(unsigned char *aggregate_public_key, const unsigned char *public_keys_hash, const unsigned char *public_keys, const size_t num_public_keys) {
-    unsigned char delinearized_public_key[32];
+static int aggregate_delinearized_public_keys(unsigned char *aggregate_public_key, const unsigned char *public_keys_hash, const unsigned char *public_keys, size_t num_public_keys, ed25519_multisig_cosigner *cosigners) {
+    sha512_context hash;
+    unsigned char r[64];
+    unsigned char scalars[GE_MULTI_SIZE][32];
+    unsigned char valid[GE_MULTI_SIZE];
+    ge_cached tables[GE_MULTI_SIZE][8];
     ge_p1p1 sum_tmp;
     ge_p3 sum;
-    ge_p3 delinearized_public_key_unpacked;
-    ge_cached delinearized_public_key_cached;
+    ge_p3 chunk_sum;
+    ge_p2 chunk_sum_p2;
+    ge_cached chunk_sum_cached;
+    size_t chunk;
 
     ge_p3_0(&sum);
 
-    for (size_t i = 0; i < num_public_keys; ++i) {
-        const unsigned char *public_key = public_keys + (i * 32);
+    for (size_t start = 0; start < num_public_keys; start += chunk) {
+        chunk = num_public_keys - start < GE_MULTI_SIZE ? num_public_keys - start : GE_MULTI_SIZE;
+
+        /* the cache holds -P_i */
+        key_cache_get_many(tables, valid, public_keys + (start * 32), chunk);
+
+        for (size_t i = 0; i < chunk; ++i) {
+            const unsigned char *public_key = public_keys + ((start + i) * 32);
+
+            if (!valid[i]) {
+                return 0;
+            }
 
-        ed25519_delinearize_public_key(delinearized_public_key, public_keys_hash, public_key);
+            // Compute H(C||P_i).
+            sha512_init(&hash);
+            sha512_update(&hash, public_keys_hash, 64);
+            sha512_update(&hash, public_key, 32);
+            sha512_final(&hash, r);
+            sc_reduce(r);
 
-        /* unpack delinearized public key */
-        ge_frombytes_negate_vartime(&delinearized_public_key_unpacked, delinearized_public_key);
-        fe_neg(delinearized_public_key_unpacked.X, delinearized_public_key_unpacked.X); /* undo negate */
-        fe_neg(delinearized_public_key_unpacked.T, delinearized_public_key_unpacked.T); /* undo negate */
+            if (cosigners) {
+                memcpy(cosigners[start + i].public_key, public_key, 32);
+                memcpy(cosigners[start + i].delinearization_scalar, r, 32);
+            }
 
-        if (i == 0) {
-            sum = delinearized_public_key_unpacked;
-            continue;
+            memcpy(scalars[i], r, 32);
         }
-        
-        ge_p3_to_cached(&delinearized_public_key_cached, &delinearized_public_key_unpacked);
-        
-        /* sum = sum + public key */
-        ge_add(&sum_tmp, &sum, &delinearized_public_key_cached);
+
+        /* sum = sum + ∑ H(C||P_i) (-P_i) */
+        ge_multi_scalarmult_vartime(&chunk_sum_p2, scalars[0], (const ge_cached (*)[8]) tables, chunk);
+        ge_p2_to_p3(&chunk_sum, &chunk_sum_p2);
+        ge_p3_to_cached(&chunk_sum_cached, &chunk_sum);
+        ge_add(&sum_tmp, &sum, &chunk_sum_cached);
         ge_p1p1_to_p3(&sum, &sum_tmp);
     }
-    
+
+    /* undo negate */
+    fe_neg(sum.X, sum.X);
+    fe_neg(sum.T, sum.T);
+
     /* pack point */
     ge_p3_tobytes(aggregate_public_key, &sum);
+    return 1;
+}
+
+/*
+ * Let C = public_keys_hash = H(P_1 || ... || P_n).
+ * Aggregates a set of public keys P_1, ..., P_n to P = ∑ H(C || P_i) P_i.
+ * Returns 0 if one of the keys is not a valid point.
+ */
+
+int ed25519_aggregate_delinearized_public_keys(unsigned char *aggregate_public_key, const unsigned char *public_keys_hash, const unsigned char *public_keys, const size_t num_public_keys) {
+    return aggregate_delinearized_public_keys(aggregate_public_key, public_keys_hash, public_keys, num_public_keys, NULL);
 }
 
 /*
  * Let public_keys_hash = C = H(P_1 || ... || P_n).
  * Delinearizes a public key P' = H(C || P) P.
+ * Returns 0 if the public key is not a valid point.
  */
 
-void ed25519_delinearize_public_key(unsigned char *delinearized_public_key, const unsigned char *public_keys_hash, const unsigned char *public_key) {
+int ed25519_delinearize_public_key(unsigned char *delinearized_public_key, const unsigned char *public_keys_hash, const unsigned char *public_key) {
     sha512_context hash;
     unsigned char pH[64];
+    unsigned char valid;
     ge_p3 P;
     ge_p2 P_prime;
     const unsigned char SC_0[32] = {0}; /* scalar with value 0 */
 
     // Compute P.
     /* unpack point public_key into P */
-    ge_frombytes_negate_vartime(&P, public_key);
-    fe_neg(P.X, P.X); /* undo negate */
-    fe_neg(P.T, P.T); /* undo negate */
+    ge_frombytes_many_vartime(&P, &valid, public_key, 1, 0);
+    if (!valid) {
+        return 0;
+    }
 
     // Compute H(C||P).
     sha512_init(&hash);
@@ -116,42 +163,69 @@ void ed25519_delinearize_public_key(unsigned char *delinearized_public_key, cons
     // Compute H(C||P)P.
     ge_double_scalarmult_vartime(&P_prime, pH, &P, SC_0);
     ge_tobytes(delinearized_public_key, &P_prime);
+    return 1;
 }
 
 /*
- * Aggregates a set of commitments.
+ * Sets up a multisig context for the public keys P_1, ..., P_n in the order
+ * used for the multisig. If private_key is not NULL, public_key must be its
+ * public key, and the delinearized private key is stored for signing.
+ * context must provide ED25519_MULTISIG_CONTEXT_SIZE(num_cosigners) bytes.
+ * Returns 0 if one of the public keys is not a valid point.
  */
 
-void ed25519_aggregate_commitments(unsigned char *aggregate_commitment, const unsigned char *commitments, const size_t num_commitments) {
+int ed25519_multisig_context_init(ed25519_multisig_context *context, const unsigned char *public_keys, size_t num_cosigners, const unsigned char *public_key, const unsigned char *private_key) {
+    context->num_cosigners = (uint32_t) num_cosigners;
+    ed25519_hash_public_keys(context->public_keys_hash, public_keys, num_cosigners);
+    if (!aggregate_delinearized_public_keys(context->aggregate_public_key, context->public_keys_hash, public_keys, num_cosigners, context->cosigners)) {
+        return 0;
+    }
+
+    if (private_key) {
+        ed25519_derive_delinearized_private_key(context->delinearized_private_key, context->public_keys_hash, public_key, private_key);
+    } else {
+        memset(context->delinearized_private_key, 0, 32);
+    }
+    return 1;
+}
+
+/*
+ * Aggregates a set of commitments, decoding GE_BATCH_SIZE of them at a time.
+ * Returns 0 without writing the aggregate if one of the commitments is not a valid point.
+ */
+
+int ed25519_aggregate_commitments(unsigned char *aggregate_commitment, const unsigned char *commitments, const size_t num_commitments) {
+    unsigned char valid[GE_BATCH_SIZE];
     ge_p1p1 sum_tmp;
     ge_p3 sum;
-    ge_p3 commitment_unpacked;
+    ge_p3 commitments_unpacked[GE_BATCH_SIZE];
     ge_cached commitment_cached;
+    size_t chunk;
 
     ge_p3_0(&sum);
 
-    for (size_t i = 0; i < num_commitments; ++i) {
-        const unsigned char *commitment = commitments + (i * 32);
+    for (size_t start = 0; start < num_commitments; start += chunk) {
+        chunk = num_commitments - start < GE_BATCH_SIZE ? num_commitments - start : GE_BATCH_SIZE;
 
-        /* unpack delinearized public key */
-        ge_frombytes_negate_vartime(&commitment_unpacked, commitment);
-        fe_neg(commitment_unpacked.X, commitment_unpacked.X); /* undo negate */
-        fe_neg(commitment_unpacked.T, commitment_unpacked.T); /* undo negate */
+        /* unpack commitments */
+        ge_frombytes_many_vartime(commitments_unpacked, valid, commitments + (start * 32), chunk, 0);
 
-        if (i == 0) {
-            sum = commitment_unpacked;
-            continue;
+        for (size_t i = 0; i < chunk; ++i) {
+            if (!valid[i]) {
+                return 0;
+            }
+
+            ge_p3_to_cached(&commitment_cached, &commitments_unpacked[i]);
+
+            /* sum = sum + commitment */
+            ge_add(&sum_tmp, &sum, &commitment_cached);
+            ge_p1p1_to_p3(&sum, &sum_tmp);
         }
-        
-        ge_p3_to_cached(&commitment_cached, &commitment_unpacked);
-        
-        /* sum = sum + public key */
-        ge_add(&sum_tmp, &sum, &commitment_cached);
-        ge_p1p1_to_p3(&sum, &sum_tmp);
     }
-    
+
     /* pack point */
     ge_p3_tobytes(aggregate_commitment, &sum);
+    return 1;
 }
 
 /*
@@ -191,3 +265,39 @@ int ed25519_create_commitment(unsigned char *secret_r, unsigned char *commitment
 
     return 1;
 }
+
+/*
+ * Creates n commitments like ed25519_create_commitment, from 32 bytes of
+ * randomness each. The points are encoded in chunks of GE_BATCH_SIZE with a
+ * single field inversion per chunk. Returns 1 if all secrets are valid, 0 if
+ * any of them equals 0 or 1 mod l, in which case the caller should start over
+ * with fresh randomness.
+ */
+
+int ed25519_create_commitments(unsigned char *secrets_r, unsigned char *commitments_R, const unsigned char *randomness, size_t n) {
+    unsigned char r[64];
+    ge_p3 R[GE_BATCH_SIZE];
+    size_t chunk;
+    size_t i;
+    int all_valid = 1;
+
+    for ( ; n > 0; n -= chunk) {
+        chunk = n < GE_BATCH_SIZE ? n : GE_BATCH_SIZE;
+
+        for (i = 0; i < chunk; ++i) {
+            sha512(randomness + 32 * i, 32, r);
+            sc_reduce(r);
+            all_valid &= sc_valid_reduction(r);
+
+            ge_scalarmult_base(&R[i], r);
+            memcpy(secrets_r + 32 * i, r, 32);
+        }
+        ge_p3_batch_tobytes(commitments_R, R, chunk);
+
+        secrets_r += 32 * chunk;
+        commitments_R += 32 * chunk;
+        randomness += 32 * chunk;
+    }
+
+    return all_valid;
+}
@@ -3,6 +3,12 @@
 
 #include <stddef.h>
 
+#include "fixedint.h"
+#include "sha512.h"
+
+/* signatures per multi-scalar multiplication: 2 points each plus the base point */
+#define ED25519_VERIFY_BATCH_SIZE 31
+
 #if defined(_WIN32)
     #if defined(ED25519_BUILD_DLL)
         #define ED25519_DECLSPEC __declspec(dllexport)
@@ -16,6 +22,39 @@
 #endif
 
 
+/*
+ * A private key expanded once for signing many messages: the clamped scalar
+ * az[0..32), the nonce prefix az[32..64), the hash state after absorbing the
+ * prefix and the public key.
+ */
+typedef struct ed25519_expanded_key_ {
+    unsigned char az[64];
+    sha512_context prefix;
+    unsigned char public_key[32];
+} ed25519_expanded_key;
+
+/*
+ * What a cosigner of a delinearized multisig needs to partially sign many
+ * messages: C = H(P_1 || ... || P_n), the aggregate public key
+ * P = sum H(C || P_i) P_i, the delinearized private key of the signer and,
+ * for each cosigner, P_i with its delinearization scalar H(C || P_i) mod l.
+ * The n cosigners follow the fixed part, see ED25519_MULTISIG_CONTEXT_SIZE.
+ */
+typedef struct ed25519_multisig_cosigner_ {
+    unsigned char public_key[32];
+    unsigned char delinearization_scalar[32];
+} ed25519_multisig_cosigner;
+
+typedef struct ed25519_multisig_context_ {
+    uint32_t num_cosigners;
+    unsigned char public_keys_hash[64];
+    unsigned char aggregate_public_key[32];
+    unsigned char delinearized_private_key[32];
+    ed25519_multisig_cosigner cosigners[];
+} ed25519_multisig_context;
+
+#define ED25519_MULTISIG_CONTEXT_SIZE(n) (sizeof(ed25519_multisig_context) + sizeof(ed25519_multisig_cosigner) * (size_t) (n))
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -23,22 +62,34 @@ extern "C" {
 /* Common functions */
 void ed25519_private_key_decompress(unsigned char *az, const unsigned char *private_key);
 int ED25519_DECLSPEC ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key);
+int ED25519_DECLSPEC ed25519_verify_cached(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key);
+int ED25519_DECLSPEC ed25519_verify_many(unsigned char *valid, const unsigned char *signatures, const unsigned char *messages, const uint32_t *message_lens, const unsigned char *public_keys, size_t n);
+int ED25519_DECLSPEC ed25519_verify_batch(unsigned char *valid, const unsigned char *signatures, const unsigned char *messages, const uint32_t *message_lens, const unsigned char *public_keys, size_t n, const unsigned char *randomness);
 
 /* Single signature functions */
 void ED25519_DECLSPEC ed25519_public_key_derive(unsigned char *out_public_key, const unsigned char *private_key);
+void ED25519_DECLSPEC ed25519_public_keys_derive(unsigned char *public_keys, const unsigned char *private_keys, size_t n);
 void ED25519_DECLSPEC ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *private_key);
+void ED25519_DECLSPEC ed25519_expand_key(ed25519_expanded_key *key, const unsigned char *private_key);
+void ED25519_DECLSPEC ed25519_sign_expanded(unsigned char *signature, const unsigned char *message, size_t message_len, const ed25519_expanded_key *key);
+void ED25519_DECLSPEC ed25519_sign_many(unsigned char *signatures, const unsigned char *messages, const uint32_t *message_lens, size_t n, const ed25519_expanded_key *key);
 
 /* Common multisig functions */
 int ED25519_DECLSPEC ed25519_create_commitment(unsigned char *secret_r, unsigned char *commitment_R, const unsigned char *randomness);
-void ED25519_DECLSPEC ed25519_aggregate_commitments(unsigned char *aggregate_commitment, const unsigned char *commitments, const size_t num_commitments);
+int ED25519_DECLSPEC ed25519_create_commitments(unsigned char *secrets_r, unsigned char *commitments_R, const unsigned char *randomness, size_t n);
+int ED25519_DECLSPEC ed25519_aggregate_commitments(unsigned char *aggregate_commitment, const unsigned char *commitments, const size_t num_commitments);
 void ED25519_DECLSPEC ed25519_add_scalars(unsigned char *scalar_AB, const unsigned char *scalar_A, const unsigned char *scalar_B);
 
 /* Delinearized multisig functions */
 void ED25519_DECLSPEC ed25519_hash_public_keys(unsigned char *hash, const unsigned char *public_keys, const size_t num_public_keys);
-void ED25519_DECLSPEC ed25519_delinearize_public_key(unsigned char *delinearized_public_key, const unsigned char *public_keys_hash, const unsigned char *public_key);
-void ED25519_DECLSPEC ed25519_aggregate_delinearized_public_keys(unsigned char *aggregate_public_key, const unsigned char *public_keys_hash, const unsigned char *public_keys, const size_t num_public_keys);
+int ED25519_DECLSPEC ed25519_delinearize_public_key(unsigned char *delinearized_public_key, const unsigned char *public_keys_hash, const unsigned char *public_key);
+int ED25519_DECLSPEC ed25519_aggregate_delinearized_public_keys(unsigned char *aggregate_public_key, const unsigned char *public_keys_hash, const unsigned char *public_keys, const size_t num_public_keys);
 void ED25519_DECLSPEC ed25519_derive_delinearized_private_key(unsigned char *multisig_private_key, const unsigned char *public_keys_hash, const unsigned char *public_key, const unsigned char *private_key);
 void ED25519_DECLSPEC ed25519_delinearized_partial_sign(unsigned char *partial_signature, const unsigned char *message, size_t message_len, const unsigned char* commitment_R, const unsigned char *secret_r, const unsigned char *public_keys, size_t num_cosigners, const unsigned char *public_key, const unsigned char *private_key);
+int ED25519_DECLSPEC ed25519_multisig_context_init(ed25519_multisig_context *context, const unsigned char *public_keys, size_t num_cosigners, const unsigned char *public_key, const unsigned char *private_key);
+void ED25519_DECLSPEC ed25519_multisig_partial_sign(unsigned char *partial_signature, const unsigned char *message, size_t message_len, const unsigned char *commitment_R, const unsigned char *secret_r, const ed25519_multisig_context *context);
+int ED25519_DECLSPEC ed25519_multisig_verify_partial(const unsigned char *partial_signature, const unsigned char *commitment_R, const unsigned char *message, size_t message_len, const unsigned char *aggregate_commitment, size_t cosigner, const ed25519_multisig_context *context);
+int ED25519_DECLSPEC ed25519_multisig_verify_partials(unsigned char *valid, const unsigned char *partial_signatures, const unsigned char *commitments, const unsigned char *message, size_t message_len, const unsigned char *aggregate_commitment, const ed25519_multisig_context *context, const unsigned char *randomness);
 
 #ifdef __cplusplus
 }
@@ -1,6 +1,12 @@
 #include "fixedint.h"
 #include "fe.h"
 
+/*
+    The ref10 field arithmetic. fe_invert, fe_isnegative, fe_isnonzero and
+    fe_pow22523 only use the functions below and are shared with fe51.c.
+*/
+#ifndef ED25519_FE51
+
 
 /*
     helper functions
@@ -359,6 +365,8 @@ void fe_frombytes(fe h, const unsigned char *s) {
     h[9] = (int32_t) h9;
 }
 
+#endif
+
 
 
 void fe_invert(fe out, const fe z) {
@@ -519,6 +527,8 @@ int fe_isnonzero(const fe f) {
     return r != 0;
 }
 
+#ifndef ED25519_FE51
+
 
 
 /*
@@ -877,6 +887,8 @@ void fe_neg(fe h, const fe f) {
     h[9] = h9;
 }
 
+#endif
+
 
 void fe_pow22523(fe out, const fe z) {
     fe t0;
@@ -963,6 +975,8 @@ void fe_pow22523(fe out, const fe z) {
     return;
 }
 
+#ifndef ED25519_FE51
+
 
 /*
 h = f * f
@@ -1489,3 +1503,5 @@ void fe_tobytes(unsigned char *s, const fe h) {
     s[30] = (unsigned char) (h9 >> 10);
     s[31] = (unsigned char) (h9 >> 18);
 }
+
+#endif
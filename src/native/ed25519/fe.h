@@ -4,6 +4,27 @@
 #include "fixedint.h"
 
 
+/*
+    64-bit targets with 128 bit multiplication use the radix 2^51 backend in
+    fe51.c, everything else the ref10 code in fe.c. Define ED25519_NO_FE51
+    to force the ref10 code.
+*/
+#if defined(__SIZEOF_INT128__) && (defined(__x86_64__) || defined(__aarch64__)) && !defined(ED25519_NO_FE51)
+#define ED25519_FE51
+#endif
+
+
+#ifdef ED25519_FE51
+/*
+    fe means field element.
+    Here the field is \Z/(2^255-19).
+    An element t, entries t[0]...t[4], represents the integer
+    t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4].
+    Limbs are unsigned and may exceed 2^51 between reductions.
+*/
+
+typedef uint64_t fe[5];
+#else
 /*
     fe means field element.
     Here the field is \Z/(2^255-19).
@@ -12,8 +33,8 @@
     Bounds on each t[i] vary depending on context.
 */
 
-
 typedef int32_t fe[10];
+#endif
 
 
 void fe_0(fe h);
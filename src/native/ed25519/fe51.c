@@ -0,0 +1,377 @@
+#include "fixedint.h"
+#include "fe.h"
+
+#ifdef ED25519_FE51
+
+/*
+    Field arithmetic in radix 2^51 for 64-bit targets, see fe.h. Products are
+    accumulated in 128 bit, which replaces the 100 32x32 bit products of a
+    ref10 multiplication with 25 64x64 bit ones.
+
+    Unless noted otherwise, inputs have limbs below 2^54 and results of
+    fe_mul, fe_sq and fe_sq2 have limbs below 2^51 + 2^13.
+*/
+
+typedef unsigned __int128 uint128_t;
+
+#define FE51_MASK 0x7ffffffffffffULL
+
+
+/*
+    helper functions
+*/
+static uint64_t load_8(const unsigned char *in) {
+    uint64_t result = 0;
+    int i;
+
+    for (i = 7; i >= 0; --i) {
+        result = (result << 8) | in[i];
+    }
+
+    return result;
+}
+
+static void store_8(unsigned char *out, uint64_t in) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        out[i] = (unsigned char) (in >> (8 * i));
+    }
+}
+
+/* Reduces the 128 bit limb sums of a product to limbs below 2^51 + 2^13. */
+static void fe51_carry(fe h, uint128_t r0, uint128_t r1, uint128_t r2, uint128_t r3, uint128_t r4) {
+    uint64_t h0, h1, h2, h3, h4;
+    uint64_t carry;
+
+    r1 += (uint64_t) (r0 >> 51);
+    h0 = (uint64_t) r0 & FE51_MASK;
+    r2 += (uint64_t) (r1 >> 51);
+    h1 = (uint64_t) r1 & FE51_MASK;
+    r3 += (uint64_t) (r2 >> 51);
+    h2 = (uint64_t) r2 & FE51_MASK;
+    r4 += (uint64_t) (r3 >> 51);
+    h3 = (uint64_t) r3 & FE51_MASK;
+    carry = (uint64_t) (r4 >> 51);
+    h4 = (uint64_t) r4 & FE51_MASK;
+
+    h0 += carry * 19;
+    h1 += h0 >> 51;
+    h0 &= FE51_MASK;
+
+    h[0] = h0;
+    h[1] = h1;
+    h[2] = h2;
+    h[3] = h3;
+    h[4] = h4;
+}
+
+
+
+/*
+    h = 0
+*/
+
+void fe_0(fe h) {
+    h[0] = 0;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+
+
+/*
+    h = 1
+*/
+
+void fe_1(fe h) {
+    h[0] = 1;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+
+
+/*
+    h = f + g
+    Can overlap h with f or g.
+    The limbs are not carried, so h has limbs below 2^55 for inputs below 2^54.
+*/
+
+void fe_add(fe h, const fe f, const fe g) {
+    h[0] = f[0] + g[0];
+    h[1] = f[1] + g[1];
+    h[2] = f[2] + g[2];
+    h[3] = f[3] + g[3];
+    h[4] = f[4] + g[4];
+}
+
+
+
+/*
+    Replace (f,g) with (g,g) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+
+void fe_cmov(fe f, const fe g, unsigned int b) {
+    uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+
+    f[0] ^= (f[0] ^ g[0]) & mask;
+    f[1] ^= (f[1] ^ g[1]) & mask;
+    f[2] ^= (f[2] ^ g[2]) & mask;
+    f[3] ^= (f[3] ^ g[3]) & mask;
+    f[4] ^= (f[4] ^ g[4]) & mask;
+}
+
+
+
+/*
+    Replace (f,g) with (g,f) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+
+void fe_cswap(fe f, fe g, unsigned int b) {
+    uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+    uint64_t x;
+    int i;
+
+    for (i = 0; i < 5; ++i) {
+        x = (f[i] ^ g[i]) & mask;
+        f[i] ^= x;
+        g[i] ^= x;
+    }
+}
+
+
+
+/*
+    h = f
+*/
+
+void fe_copy(fe h, const fe f) {
+    h[0] = f[0];
+    h[1] = f[1];
+    h[2] = f[2];
+    h[3] = f[3];
+    h[4] = f[4];
+}
+
+
+
+/*
+    Ignores top bit of s, like the ref10 version.
+*/
+
+void fe_frombytes(fe h, const unsigned char *s) {
+    h[0] = load_8(s) & FE51_MASK;
+    h[1] = (load_8(s + 6) >> 3) & FE51_MASK;
+    h[2] = (load_8(s + 12) >> 6) & FE51_MASK;
+    h[3] = (load_8(s + 19) >> 1) & FE51_MASK;
+    h[4] = (load_8(s + 24) >> 12) & FE51_MASK;
+}
+
+
+
+/*
+    h = f * g
+    Can overlap h with f or g.
+*/
+
+void fe_mul(fe h, const fe f, const fe g) {
+    uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+    uint64_t g1_19 = 19 * g1;
+    uint64_t g2_19 = 19 * g2;
+    uint64_t g3_19 = 19 * g3;
+    uint64_t g4_19 = 19 * g4;
+    uint128_t r0, r1, r2, r3, r4;
+
+    r0 = (uint128_t) f0 * g0 + (uint128_t) f1 * g4_19 + (uint128_t) f2 * g3_19 + (uint128_t) f3 * g2_19 + (uint128_t) f4 * g1_19;
+    r1 = (uint128_t) f0 * g1 + (uint128_t) f1 * g0 + (uint128_t) f2 * g4_19 + (uint128_t) f3 * g3_19 + (uint128_t) f4 * g2_19;
+    r2 = (uint128_t) f0 * g2 + (uint128_t) f1 * g1 + (uint128_t) f2 * g0 + (uint128_t) f3 * g4_19 + (uint128_t) f4 * g3_19;
+    r3 = (uint128_t) f0 * g3 + (uint128_t) f1 * g2 + (uint128_t) f2 * g1 + (uint128_t) f3 * g0 + (uint128_t) f4 * g4_19;
+    r4 = (uint128_t) f0 * g4 + (uint128_t) f1 * g3 + (uint128_t) f2 * g2 + (uint128_t) f3 * g1 + (uint128_t) f4 * g0;
+
+    fe51_carry(h, r0, r1, r2, r3, r4);
+}
+
+
+
+/*
+    h = f * 121666
+    Can overlap h with f.
+*/
+
+void fe_mul121666(fe h, fe f) {
+    fe51_carry(h, (uint128_t) f[0] * 121666, (uint128_t) f[1] * 121666, (uint128_t) f[2] * 121666,
+               (uint128_t) f[3] * 121666, (uint128_t) f[4] * 121666);
+}
+
+
+
+/*
+    h = -f
+*/
+
+void fe_neg(fe h, const fe f) {
+    fe zero;
+
+    fe_0(zero);
+    fe_sub(h, zero, f);
+}
+
+
+
+/*
+    h = f * f
+    Can overlap h with f.
+*/
+
+void fe_sq(fe h, const fe f) {
+    uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    uint64_t f0_2 = 2 * f0;
+    uint64_t f1_2 = 2 * f1;
+    uint64_t f1_38 = 38 * f1;
+    uint64_t f2_38 = 38 * f2;
+    uint64_t f3_38 = 38 * f3;
+    uint64_t f3_19 = 19 * f3;
+    uint64_t f4_19 = 19 * f4;
+    uint128_t r0, r1, r2, r3, r4;
+
+    r0 = (uint128_t) f0 * f0 + (uint128_t) f1_38 * f4 + (uint128_t) f2_38 * f3;
+    r1 = (uint128_t) f0_2 * f1 + (uint128_t) f2_38 * f4 + (uint128_t) f3_19 * f3;
+    r2 = (uint128_t) f0_2 * f2 + (uint128_t) f1 * f1 + (uint128_t) f3_38 * f4;
+    r3 = (uint128_t) f0_2 * f3 + (uint128_t) f1_2 * f2 + (uint128_t) f4_19 * f4;
+    r4 = (uint128_t) f0_2 * f4 + (uint128_t) f1_2 * f3 + (uint128_t) f2 * f2;
+
+    fe51_carry(h, r0, r1, r2, r3, r4);
+}
+
+
+
+/*
+    h = 2 * f * f
+    Can overlap h with f.
+*/
+
+void fe_sq2(fe h, const fe f) {
+    uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    uint64_t f0_2 = 2 * f0;
+    uint64_t f1_2 = 2 * f1;
+    uint64_t f1_38 = 38 * f1;
+    uint64_t f2_38 = 38 * f2;
+    uint64_t f3_38 = 38 * f3;
+    uint64_t f3_19 = 19 * f3;
+    uint64_t f4_19 = 19 * f4;
+    uint128_t r0, r1, r2, r3, r4;
+
+    r0 = (uint128_t) f0 * f0 + (uint128_t) f1_38 * f4 + (uint128_t) f2_38 * f3;
+    r1 = (uint128_t) f0_2 * f1 + (uint128_t) f2_38 * f4 + (uint128_t) f3_19 * f3;
+    r2 = (uint128_t) f0_2 * f2 + (uint128_t) f1 * f1 + (uint128_t) f3_38 * f4;
+    r3 = (uint128_t) f0_2 * f3 + (uint128_t) f1_2 * f2 + (uint128_t) f4_19 * f4;
+    r4 = (uint128_t) f0_2 * f4 + (uint128_t) f1_2 * f3 + (uint128_t) f2 * f2;
+
+    fe51_carry(h, r0 << 1, r1 << 1, r2 << 1, r3 << 1, r4 << 1);
+}
+
+
+
+/*
+    h = f - g
+    Can overlap h with f or g.
+    g is carried first and 2p is added to f, so h stays positive with limbs
+    below f + 2^52.
+*/
+
+void fe_sub(fe h, const fe f, const fe g) {
+    uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+
+    g1 += g0 >> 51;
+    g0 &= FE51_MASK;
+    g2 += g1 >> 51;
+    g1 &= FE51_MASK;
+    g3 += g2 >> 51;
+    g2 &= FE51_MASK;
+    g4 += g3 >> 51;
+    g3 &= FE51_MASK;
+    g0 += 19 * (g4 >> 51);
+    g4 &= FE51_MASK;
+
+    h[0] = (f[0] + 0xfffffffffffdaULL) - g0;
+    h[1] = (f[1] + 0xffffffffffffeULL) - g1;
+    h[2] = (f[2] + 0xffffffffffffeULL) - g2;
+    h[3] = (f[3] + 0xffffffffffffeULL) - g3;
+    h[4] = (f[4] + 0xffffffffffffeULL) - g4;
+}
+
+
+
+/*
+    Writes the unique representative of h in [0, p) as 32 bytes, little endian.
+*/
+
+void fe_tobytes(unsigned char *s, const fe h) {
+    uint64_t t[5];
+    int i;
+
+    fe_copy(t, h);
+
+    /* Two carry passes leave the limbs below 2^51, so t is in [0, 2^255). */
+    for (i = 0; i < 2; ++i) {
+        t[1] += t[0] >> 51;
+        t[0] &= FE51_MASK;
+        t[2] += t[1] >> 51;
+        t[1] &= FE51_MASK;
+        t[3] += t[2] >> 51;
+        t[2] &= FE51_MASK;
+        t[4] += t[3] >> 51;
+        t[3] &= FE51_MASK;
+        t[0] += 19 * (t[4] >> 51);
+        t[4] &= FE51_MASK;
+    }
+
+    /* t + 19 overflows 2^255 exactly if t >= p, in which case the carry subtracts p. */
+    t[0] += 19;
+    t[1] += t[0] >> 51;
+    t[0] &= FE51_MASK;
+    t[2] += t[1] >> 51;
+    t[1] &= FE51_MASK;
+    t[3] += t[2] >> 51;
+    t[2] &= FE51_MASK;
+    t[4] += t[3] >> 51;
+    t[3] &= FE51_MASK;
+    t[0] += 19 * (t[4] >> 51);
+    t[4] &= FE51_MASK;
+
+    /* Subtract the 19 again by adding 2^255 - 19 and dropping bit 255. */
+    t[0] += 0x8000000000000ULL - 19;
+    t[1] += 0x8000000000000ULL - 1;
+    t[2] += 0x8000000000000ULL - 1;
+    t[3] += 0x8000000000000ULL - 1;
+    t[4] += 0x8000000000000ULL - 1;
+
+    t[1] += t[0] >> 51;
+    t[0] &= FE51_MASK;
+    t[2] += t[1] >> 51;
+    t[1] &= FE51_MASK;
+    t[3] += t[2] >> 51;
+    t[2] &= FE51_MASK;
+    t[4] += t[3] >> 51;
+    t[3] &= FE51_MASK;
+    t[4] &= FE51_MASK;
+
+    store_8(s, t[0] | (t[1] << 51));
+    store_8(s + 8, (t[1] >> 13) | (t[2] << 38));
+    store_8(s + 16, (t[2] >> 26) | (t[3] << 25));
+    store_8(s + 24, (t[3] >> 39) | (t[4] << 12));
+}
+
+#endif
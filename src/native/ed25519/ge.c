@@ -1,5 +1,10 @@
 #include "ge.h"
+#include "ge_avx2.h"
+#ifdef ED25519_FE51
+#include "precomp_data51.h"
+#else
 #include "precomp_data.h"
+#endif
 
 
 /*
@@ -57,6 +62,23 @@ static void slide(signed char *r, const unsigned char *a) {
         }
 }
 
+/* Ai = A, 3A, 5A, 7A, 9A, 11A, 13A, 15A */
+void ge_p3_odd_multiples(ge_cached *Ai, const ge_p3 *A) {
+    ge_p1p1 t;
+    ge_p3 u;
+    ge_p3 A2;
+    int i;
+    ge_p3_to_cached(&Ai[0], A);
+    ge_p3_dbl(&t, A);
+    ge_p1p1_to_p3(&A2, &t);
+
+    for (i = 1; i < 8; ++i) {
+        ge_add(&t, &A2, &Ai[i - 1]);
+        ge_p1p1_to_p3(&u, &t);
+        ge_p3_to_cached(&Ai[i], &u);
+    }
+}
+
 /*
 r = a * A + b * B
 where a = a[0]+256*a[1]+...+256^31 a[31].
@@ -65,39 +87,24 @@ B is the Ed25519 base point (x,4/5) with x positive.
 */
 
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b) {
+    ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
+    ge_p3_odd_multiples(Ai, A);
+    ge_double_scalarmult_vartime_cached(r, a, Ai, b);
+}
+
+/*
+Same as ge_double_scalarmult_vartime, with the odd multiples of A
+precomputed by ge_p3_odd_multiples.
+*/
+
+void ge_double_scalarmult_vartime_cached(ge_p2 *r, const unsigned char *a, const ge_cached *Ai, const unsigned char *b) {
     signed char aslide[256];
     signed char bslide[256];
-    ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
     ge_p1p1 t;
     ge_p3 u;
-    ge_p3 A2;
     int i;
     slide(aslide, a);
     slide(bslide, b);
-    ge_p3_to_cached(&Ai[0], A);
-    ge_p3_dbl(&t, A);
-    ge_p1p1_to_p3(&A2, &t);
-    ge_add(&t, &A2, &Ai[0]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[1], &u);
-    ge_add(&t, &A2, &Ai[1]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[2], &u);
-    ge_add(&t, &A2, &Ai[2]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[3], &u);
-    ge_add(&t, &A2, &Ai[3]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[4], &u);
-    ge_add(&t, &A2, &Ai[4]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[5], &u);
-    ge_add(&t, &A2, &Ai[5]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[6], &u);
-    ge_add(&t, &A2, &Ai[6]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[7], &u);
     ge_p2_0(r);
 
     for (i = 255; i >= 0; --i) {
@@ -106,6 +113,13 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
         }
     }
 
+#ifdef GE_AVX2
+    if (ge_avx2_supported()) {
+        ge_avx2_double_scalarmult_vartime(r, aslide, Ai, bslide, Bi, i);
+        return;
+    }
+#endif
+
     for (; i >= 0; --i) {
         ge_p2_dbl(&t, r);
 
@@ -130,6 +144,67 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
 }
 
 
+/*
+r = a[0] * A[0] + ... + a[n-1] * A[n-1]
+where each a[i] is a 32 byte scalar as above with a[i][31] <= 127
+and Ai[i] holds the odd multiples of A[i] (see ge_p3_odd_multiples),
+using signed sliding windows over all scalars at once (Straus' method).
+n must not exceed GE_MULTI_SIZE.
+*/
+
+void ge_multi_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_cached (*Ai)[8], size_t n) {
+    signed char slides[GE_MULTI_SIZE][256];
+    ge_p1p1 t;
+    ge_p3 u;
+    size_t j;
+    int top = -1;
+    int i;
+
+    for (j = 0; j < n; ++j) {
+        slide(slides[j], a + 32 * j);
+        for (i = 255; i > top; --i) {
+            if (slides[j][i]) {
+                top = i;
+                break;
+            }
+        }
+    }
+
+#ifdef GE_AVX2
+    if (ge_avx2_supported()) {
+        ge_avx2_multi_scalarmult_vartime(r, (const signed char (*)[256]) slides, Ai, n, top);
+        return;
+    }
+#endif
+    ge_p2_0(r);
+
+    for (i = top; i >= 0; --i) {
+        ge_p2_dbl(&t, r);
+
+        for (j = 0; j < n; ++j) {
+            if (slides[j][i] > 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_add(&t, &u, &Ai[j][slides[j][i] / 2]);
+            } else if (slides[j][i] < 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_sub(&t, &u, &Ai[j][(-slides[j][i]) / 2]);
+            }
+        }
+
+        ge_p1p1_to_p2(r, &t);
+    }
+}
+
+
+#ifdef ED25519_FE51
+static const fe d = {
+    929955233495203, 466365720129213, 1662059464998953, 2033849074728123, 1442794654840575
+};
+
+static const fe sqrtm1 = {
+    1718705420411056, 234908883556509, 2233514472574048, 2117202627021982, 765476049583133
+};
+#else
 static const fe d = {
     -10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116
 };
@@ -137,13 +212,16 @@ static const fe d = {
 static const fe sqrtm1 = {
     -32595792, -7943725, 9377950, 3500415, 12389472, -272473, -25146209, -2005654, 326686, 11406482
 };
+#endif
 
-int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
-    fe u;
-    fe v;
-    fe v3;
-    fe vxx;
-    fe check;
+/*
+Decoding computes x = uv^3(uv^7)^((q-5)/8) with u = y^2-1 and v = dy^2+1.
+frombytes_prepare sets Y, Z = 1, u, v, v3 = v^3 and returns w = uv^7,
+frombytes_finish takes x = w^((q-5)/8), so that the exponentiations of
+several points can be computed together.
+*/
+
+static void frombytes_prepare(ge_p3 *h, fe u, fe v, fe v3, fe w, const unsigned char *s) {
     fe_frombytes(h->Y, s);
     fe_1(h->Z);
     fe_sq(u, h->Y);
@@ -152,11 +230,15 @@ int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     fe_add(v, v, h->Z);     /* v = dy^2+1 */
     fe_sq(v3, v);
     fe_mul(v3, v3, v);      /* v3 = v^3 */
-    fe_sq(h->X, v3);
-    fe_mul(h->X, h->X, v);
-    fe_mul(h->X, h->X, u);  /* x = uv^7 */
-    fe_pow22523(h->X, h->X); /* x = (uv^7)^((q-5)/8) */
-    fe_mul(h->X, h->X, v3);
+    fe_sq(w, v3);
+    fe_mul(w, w, v);
+    fe_mul(w, w, u);        /* w = uv^7 */
+}
+
+static int frombytes_finish(ge_p3 *h, const fe u, const fe v, const fe v3, const fe x, const unsigned char *s, int negate) {
+    fe vxx;
+    fe check;
+    fe_mul(h->X, x, v3);
     fe_mul(h->X, h->X, u);  /* x = uv^3(uv^7)^((q-5)/8) */
     fe_sq(vxx, h->X);
     fe_mul(vxx, vxx, v);
@@ -172,7 +254,7 @@ int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
         fe_mul(h->X, h->X, sqrtm1);
     }
 
-    if (fe_isnegative(h->X) == (s[31] >> 7)) {
+    if ((fe_isnegative(h->X) == (s[31] >> 7)) == negate) {
         fe_neg(h->X, h->X);
     }
 
@@ -180,6 +262,62 @@ int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     return 0;
 }
 
+int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
+    fe u;
+    fe v;
+    fe v3;
+    fe x;
+
+    frombytes_prepare(h, u, v, v3, x, s);
+    fe_pow22523(x, x); /* x = (uv^7)^((q-5)/8) */
+    return frombytes_finish(h, u, v, v3, x, s, 1);
+}
+
+/*
+Decodes the n points s[0..32n) to h, negated if negate is set. Stores 1 to
+valid[i] if the i-th encoding is a point and 0 otherwise, in which case h[i]
+is undefined. With AVX2, the exponentiations of four points at a time run in
+the lanes of one vector. Returns the number of valid points.
+*/
+
+size_t ge_frombytes_many_vartime(ge_p3 *h, unsigned char *valid, const unsigned char *s, size_t n, int negate) {
+    fe u[4];
+    fe v[4];
+    fe v3[4];
+    fe x[4];
+    size_t count = 0;
+    size_t chunk;
+    size_t i;
+
+    for ( ; n > 0; n -= chunk) {
+        chunk = n < 4 ? n : 4;
+
+        for (i = 0; i < chunk; ++i) {
+            frombytes_prepare(&h[i], u[i], v[i], v3[i], x[i], s + 32 * i);
+        }
+#ifdef GE_AVX2
+        if (chunk == 4 && ge_avx2_supported()) {
+            ge_avx2_pow22523(x, (const fe *) x);
+        } else
+#endif
+        {
+            for (i = 0; i < chunk; ++i) {
+                fe_pow22523(x[i], x[i]);
+            }
+        }
+        for (i = 0; i < chunk; ++i) {
+            valid[i] = frombytes_finish(&h[i], u[i], v[i], v3[i], x[i], s + 32 * i, negate) == 0;
+            count += valid[i];
+        }
+
+        h += chunk;
+        valid += chunk;
+        s += 32 * chunk;
+    }
+
+    return count;
+}
+
 
 /*
 r = p + q
@@ -295,9 +433,15 @@ void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p) {
 r = p
 */
 
+#ifdef ED25519_FE51
+static const fe d2 = {
+    1859910466990425, 932731440258426, 1072319116312658, 1815898335770999, 633789495995903
+};
+#else
 static const fe d2 = {
     -21827239, -5839606, -30745221, 13898782, 229458, 15978800, -12551817, -6495438, 29715968, 9444199
 };
+#endif
 
 void ge_p3_to_cached(ge_cached *r, const ge_p3 *p) {
     fe_add(r->YplusX, p->Y, p->X);
@@ -318,6 +462,18 @@ void ge_p3_to_p2(ge_p2 *r, const ge_p3 *p) {
 }
 
 
+/*
+r = p, as (XZ:YZ:Z^2:XY)
+*/
+
+void ge_p2_to_p3(ge_p3 *r, const ge_p2 *p) {
+    fe_mul(r->X, p->X, p->Z);
+    fe_mul(r->Y, p->Y, p->Z);
+    fe_sq(r->Z, p->Z);
+    fe_mul(r->T, p->X, p->Y);
+}
+
+
 void ge_p3_tobytes(unsigned char *s, const ge_p3 *h) {
     fe recip;
     fe x;
@@ -329,6 +485,66 @@ void ge_p3_tobytes(unsigned char *s, const ge_p3 *h) {
     s[31] ^= fe_isnegative(x) << 7;
 }
 
+/*
+Encodes n points to s[0..32n). The Z coordinates are inverted together with
+a single field inversion (Montgomery's trick), in chunks of GE_BATCH_SIZE.
+*/
+
+void ge_p3_batch_tobytes(unsigned char *s, const ge_p3 *h, size_t n) {
+    fe acc[GE_BATCH_SIZE];
+    fe inv;
+    fe recip;
+    fe x;
+    fe y;
+    size_t chunk;
+    size_t i;
+
+    for ( ; n > 0; n -= chunk, h += chunk, s += 32 * chunk) {
+        chunk = n < GE_BATCH_SIZE ? n : GE_BATCH_SIZE;
+
+        /* acc[i] = Z_0 * ... * Z_i */
+        fe_copy(acc[0], h[0].Z);
+        for (i = 1; i < chunk; ++i) {
+            fe_mul(acc[i], acc[i - 1], h[i].Z);
+        }
+        fe_invert(inv, acc[chunk - 1]);
+
+        /* inv = 1 / (Z_0 * ... * Z_i) on entry of each iteration */
+        for (i = chunk - 1; ; --i) {
+            if (i > 0) {
+                fe_mul(recip, inv, acc[i - 1]);
+                fe_mul(inv, inv, h[i].Z);
+            } else {
+                fe_copy(recip, inv);
+            }
+            fe_mul(x, h[i].X, recip);
+            fe_mul(y, h[i].Y, recip);
+            fe_tobytes(s + 32 * i, y);
+            s[32 * i + 31] ^= fe_isnegative(x) << 7;
+            if (i == 0) break;
+        }
+    }
+}
+
+
+/*
+Inline version of fe_cmov for the three coordinates, which works for both
+field representations and lets the compiler vectorize the table scans.
+*/
+
+static void cmov(ge_precomp *t, const ge_precomp *u, unsigned char b) {
+    int64_t mask = -(int64_t) b;
+    size_t i;
+
+    for (i = 0; i < sizeof(fe) / sizeof(t->yplusx[0]); ++i) {
+        t->yplusx[i] ^= (t->yplusx[i] ^ u->yplusx[i]) & mask;
+        t->yminusx[i] ^= (t->yminusx[i] ^ u->yminusx[i]) & mask;
+        t->xy2d[i] ^= (t->xy2d[i] ^ u->xy2d[i]) & mask;
+    }
+}
+
+
+#if ED25519_BASE_WINDOW <= 4
 
 static unsigned char equal(signed char b, signed char c) {
     unsigned char ub = b;
@@ -346,13 +562,6 @@ static unsigned char negative(signed char b) {
     return (unsigned char) x;
 }
 
-static void cmov(ge_precomp *t, const ge_precomp *u, unsigned char b) {
-    fe_cmov(t->yplusx, u->yplusx, b);
-    fe_cmov(t->yminusx, u->yminusx, b);
-    fe_cmov(t->xy2d, u->xy2d, b);
-}
-
-
 static void select(ge_precomp *t, int pos, signed char b) {
     ge_precomp minust;
     unsigned char bnegative = negative(b);
@@ -433,6 +642,161 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     }
 }
 
+#else
+
+/*
+Fixed-base multiplication with signed radix 2^ED25519_BASE_WINDOW digits and
+a table for every digit position, so that no doublings are needed:
+base_table[i][j] = (j+1) * 2^(ED25519_BASE_WINDOW*i) * B.
+The table is computed on first use.
+*/
+
+#include "lock.h"
+
+#define GE_BASE_DIGITS ((256 + ED25519_BASE_WINDOW - 1) / ED25519_BASE_WINDOW)
+#define GE_BASE_ENTRIES (1 << (ED25519_BASE_WINDOW - 1))
+
+static ge_precomp base_table[GE_BASE_DIGITS][GE_BASE_ENTRIES];
+static ed25519_once_t base_table_once = ED25519_ONCE_INIT;
+
+static void fe_reduce(fe h) {
+    unsigned char s[32];
+
+    fe_tobytes(s, h);
+    fe_frombytes(h, s);
+}
+
+/*
+row[j] = p[j] in affine coordinates, with a single inversion for the row.
+*/
+
+static void base_table_row(ge_precomp *row, const ge_p3 *p) {
+    fe acc[GE_BASE_ENTRIES];
+    fe inv;
+    fe recip;
+    fe x;
+    fe y;
+    int j;
+
+    fe_copy(acc[0], p[0].Z);
+    for (j = 1; j < GE_BASE_ENTRIES; ++j) {
+        fe_mul(acc[j], acc[j - 1], p[j].Z);
+    }
+    fe_invert(inv, acc[GE_BASE_ENTRIES - 1]);
+
+    for (j = GE_BASE_ENTRIES - 1; j >= 0; --j) {
+        if (j > 0) {
+            fe_mul(recip, inv, acc[j - 1]);
+            fe_mul(inv, inv, p[j].Z);
+        } else {
+            fe_copy(recip, inv);
+        }
+        fe_mul(x, p[j].X, recip);
+        fe_mul(y, p[j].Y, recip);
+        fe_add(row[j].yplusx, y, x);
+        fe_sub(row[j].yminusx, y, x);
+        fe_mul(row[j].xy2d, x, y);
+        fe_mul(row[j].xy2d, row[j].xy2d, d2);
+        fe_reduce(row[j].yplusx);
+        fe_reduce(row[j].yminusx);
+        fe_reduce(row[j].xy2d);
+    }
+}
+
+static void base_table_init(void) {
+    ge_p3 p[GE_BASE_ENTRIES];
+    ge_cached c;
+    ge_p1p1 r;
+    int i;
+    int j;
+
+    /* p[0] = B */
+    ge_p3_0(&p[0]);
+    ge_madd(&r, &p[0], &base[0][0]);
+    ge_p1p1_to_p3(&p[0], &r);
+
+    for (i = 0; i < GE_BASE_DIGITS; ++i) {
+        ge_p3_to_cached(&c, &p[0]);
+        for (j = 1; j < GE_BASE_ENTRIES; ++j) {
+            ge_add(&r, &p[j - 1], &c);
+            ge_p1p1_to_p3(&p[j], &r);
+        }
+        base_table_row(base_table[i], p);
+
+        /* p[0] = 2 * 2^(ED25519_BASE_WINDOW-1) * p[0] */
+        ge_p3_dbl(&r, &p[GE_BASE_ENTRIES - 1]);
+        ge_p1p1_to_p3(&p[0], &r);
+    }
+}
+
+static void select(ge_precomp *t, const ge_precomp *row, int b) {
+    ge_precomp minust;
+    unsigned int bnegative = (unsigned int) b >> 31;
+    unsigned int babs = ((unsigned int) b ^ (0 - bnegative)) + bnegative;
+    unsigned int j;
+
+    fe_1(t->yplusx);
+    fe_1(t->yminusx);
+    fe_0(t->xy2d);
+    for (j = 0; j < GE_BASE_ENTRIES; ++j) {
+        /* (babs ^ (j + 1)) - 1 wraps around iff babs == j + 1 */
+        cmov(t, &row[j], (unsigned char) (((babs ^ (j + 1)) - 1) >> 31));
+    }
+    fe_copy(minust.yplusx, t->yminusx);
+    fe_copy(minust.yminusx, t->yplusx);
+    fe_neg(minust.xy2d, t->xy2d);
+    cmov(t, &minust, (unsigned char) bnegative);
+}
+
+/*
+h = a * B
+where a = a[0]+256*a[1]+...+256^31 a[31]
+B is the Ed25519 base point (x,4/5) with x positive.
+
+Preconditions:
+  a[31] <= 127
+*/
+
+void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
+    unsigned char s[33];
+    int e[GE_BASE_DIGITS];
+    int carry;
+    ge_p1p1 r;
+    ge_precomp t;
+    int bit;
+    int i;
+
+    ed25519_once(&base_table_once, base_table_init);
+
+    for (i = 0; i < 32; ++i) {
+        s[i] = a[i];
+    }
+    s[32] = 0;
+
+    carry = 0;
+
+    for (i = 0; i < GE_BASE_DIGITS - 1; ++i) {
+        bit = ED25519_BASE_WINDOW * i;
+        e[i] = ((s[bit >> 3] | (s[(bit >> 3) + 1] << 8)) >> (bit & 7)) & ((1 << ED25519_BASE_WINDOW) - 1);
+        e[i] += carry;
+        carry = (e[i] + (1 << (ED25519_BASE_WINDOW - 1))) >> ED25519_BASE_WINDOW;
+        e[i] -= carry << ED25519_BASE_WINDOW;
+    }
+
+    bit = ED25519_BASE_WINDOW * i;
+    e[i] = ((s[bit >> 3] | (s[(bit >> 3) + 1] << 8)) >> (bit & 7)) + carry;
+    /* each e[i] is between -2^(ED25519_BASE_WINDOW-1) and 2^(ED25519_BASE_WINDOW-1) */
+    ge_p3_0(h);
+
+    for (i = 0; i < GE_BASE_DIGITS; ++i) {
+        select(&t, base_table[i], e[i]);
+        ge_madd(&r, h, &t);
+        ge_p1p1_to_p3(h, &r);
+    }
+}
+
+#endif
+
 
 /*
 r = p - q
@@ -1,8 +1,26 @@
 #ifndef GE_H
 #define GE_H
 
+#include <stddef.h>
+
 #include "fe.h"
 
+#define GE_BATCH_SIZE 64
+#define GE_MULTI_SIZE 64
+
+/*
+Window size w of ge_scalarmult_base. 4 uses the ref10 tables (30 KB).
+5 to 8 use signed radix 2^w digits without doublings and a table of
+ceil(256/w) * 2^(w-1) points that is computed on first use
+(98 KB, 161 KB, 278 KB and 480 KB). 6 is the fastest on x86-64.
+*/
+#ifndef ED25519_BASE_WINDOW
+#define ED25519_BASE_WINDOW 4
+#endif
+#if ED25519_BASE_WINDOW < 4 || ED25519_BASE_WINDOW > 8
+#error "ED25519_BASE_WINDOW must be between 4 and 8"
+#endif
+
 
 /*
 ge means group element.
@@ -52,12 +70,16 @@ typedef struct {
 } ge_cached;
 
 void ge_p3_tobytes(unsigned char *s, const ge_p3 *h);
+void ge_p3_batch_tobytes(unsigned char *s, const ge_p3 *h, size_t n);
 void ge_tobytes(unsigned char *s, const ge_p2 *h);
 int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s);
+size_t ge_frombytes_many_vartime(ge_p3 *h, unsigned char *valid, const unsigned char *s, size_t n, int negate);
 
 void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b);
+void ge_double_scalarmult_vartime_cached(ge_p2 *r, const unsigned char *a, const ge_cached *Ai, const unsigned char *b);
+void ge_multi_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_cached (*Ai)[8], size_t n);
 void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_scalarmult_base(ge_p3 *h, const unsigned char *a);
@@ -69,6 +91,8 @@ void ge_p2_dbl(ge_p1p1 *r, const ge_p2 *p);
 void ge_p3_0(ge_p3 *h);
 void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p);
 void ge_p3_to_cached(ge_cached *r, const ge_p3 *p);
+void ge_p3_odd_multiples(ge_cached *Ai, const ge_p3 *A);
 void ge_p3_to_p2(ge_p2 *r, const ge_p3 *p);
+void ge_p2_to_p3(ge_p3 *r, const ge_p2 *p);
 
 #endif
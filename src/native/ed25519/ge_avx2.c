@@ -0,0 +1,495 @@
+#include "ge_avx2.h"
+
+#ifdef GE_AVX2
+#include <immintrin.h>
+
+/*
+    A vector field element holds four field elements in radix 2^25.5, limb i
+    of element k in 64 bit lane k of v[i], with unsigned limbs. A point is a
+    vector field element with the extended coordinates (X, Y, Z, T) in its
+    lanes, a cached point has (Y - X, Y + X, 2Z, 2dT), following the parallel
+    formulas of Hisil, Wong, Carter and Dawson.
+
+    Carried limbs are below 2^26 (even) and 2^25 + 2^18 (odd). Sums and
+    differences of two carried elements are passed to fe4_mul without another
+    carry, whose 64 bit accumulators have room for limbs below 3 * 2^26.
+*/
+
+#define GE_AVX2_TARGET __attribute__((target("avx2")))
+#define GE_AVX2_INLINE __attribute__((target("avx2"), always_inline)) inline
+
+typedef struct {
+    __m256i v[10];
+} fe4;
+
+/* Same layout with 32 bit lanes, for tables of carried cached points. */
+typedef struct {
+    __m128i v[10];
+} fe4_packed;
+
+/* 2p */
+static const uint64_t fe4_2p[10] = {
+    0x7ffffda, 0x3fffffe, 0x7fffffe, 0x3fffffe, 0x7fffffe, 0x3fffffe, 0x7fffffe, 0x3fffffe, 0x7fffffe, 0x3fffffe
+};
+
+/* Splits f into 10 limbs of 26 and 25 bits. */
+static void fe_to_limbs(uint32_t *l, const fe f) {
+    uint64_t t[5];
+    int i;
+
+    fe_copy(t, f);
+    for (i = 0; i < 4; ++i) {
+        t[i + 1] += t[i] >> 51;
+        t[i] &= 0x7ffffffffffffULL;
+    }
+    t[0] += 19 * (t[4] >> 51);
+    t[4] &= 0x7ffffffffffffULL;
+    t[1] += t[0] >> 51;
+    t[0] &= 0x7ffffffffffffULL;
+
+    for (i = 0; i < 5; ++i) {
+        l[2 * i] = (uint32_t) (t[i] & 0x3ffffff);
+        l[2 * i + 1] = (uint32_t) (t[i] >> 26);
+    }
+}
+
+GE_AVX2_TARGET
+static void fe4_load(fe4 *r, const fe a, const fe b, const fe c, const fe d) {
+    uint32_t l[4][10];
+    int i;
+
+    fe_to_limbs(l[0], a);
+    fe_to_limbs(l[1], b);
+    fe_to_limbs(l[2], c);
+    fe_to_limbs(l[3], d);
+    for (i = 0; i < 10; ++i) {
+        r->v[i] = _mm256_set_epi64x(l[3][i], l[2][i], l[1][i], l[0][i]);
+    }
+}
+
+/* Stores the first three lanes of p. */
+GE_AVX2_TARGET
+static void fe4_store(fe a, fe b, fe c, const fe4 *p) {
+    uint64_t l[10][4];
+    int i;
+
+    for (i = 0; i < 10; ++i) {
+        _mm256_storeu_si256((__m256i *) l[i], p->v[i]);
+    }
+    for (i = 0; i < 5; ++i) {
+        a[i] = l[2 * i][0] + (l[2 * i + 1][0] << 26);
+        b[i] = l[2 * i][1] + (l[2 * i + 1][1] << 26);
+        c[i] = l[2 * i][2] + (l[2 * i + 1][2] << 26);
+    }
+}
+
+/* Stores lane k of p to out[k]. */
+GE_AVX2_TARGET
+static void fe4_store_lanes(fe *out, const fe4 *p) {
+    uint64_t l[10][4];
+    int i;
+    int k;
+
+    for (i = 0; i < 10; ++i) {
+        _mm256_storeu_si256((__m256i *) l[i], p->v[i]);
+    }
+    for (k = 0; k < 4; ++k) {
+        for (i = 0; i < 5; ++i) {
+            out[k][i] = l[2 * i][k] + (l[2 * i + 1][k] << 26);
+        }
+    }
+}
+
+GE_AVX2_TARGET
+static void fe4_pack(fe4_packed *r, const fe4 *p) {
+    const __m256i low = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    int i;
+
+    for (i = 0; i < 10; ++i) {
+        r->v[i] = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(p->v[i], low));
+    }
+}
+
+GE_AVX2_TARGET
+static void fe4_unpack(fe4 *r, const fe4_packed *p) {
+    int i;
+
+    for (i = 0; i < 10; ++i) {
+        r->v[i] = _mm256_cvtepu32_epi64(p->v[i]);
+    }
+}
+
+GE_AVX2_INLINE
+static void fe4_carry(fe4 *h) {
+    const __m256i mask26 = _mm256_set1_epi64x(0x3ffffff);
+    const __m256i mask25 = _mm256_set1_epi64x(0x1ffffff);
+    __m256i c;
+
+    /* two interleaved carry chains as in ref10's fe_mul */
+#define CARRY(i, bits, mask) \
+    c = _mm256_srli_epi64(h->v[i], bits); \
+    h->v[(i) + 1] = _mm256_add_epi64(h->v[(i) + 1], c); \
+    h->v[i] = _mm256_and_si256(h->v[i], mask)
+
+    CARRY(0, 26, mask26);
+    CARRY(4, 26, mask26);
+    CARRY(1, 25, mask25);
+    CARRY(5, 25, mask25);
+    CARRY(2, 26, mask26);
+    CARRY(6, 26, mask26);
+    CARRY(3, 25, mask25);
+    CARRY(7, 25, mask25);
+    CARRY(4, 26, mask26);
+    CARRY(8, 26, mask26);
+
+    c = _mm256_srli_epi64(h->v[9], 25);
+    h->v[9] = _mm256_and_si256(h->v[9], mask25);
+    /* c < 2^39, so 19c is computed with shifts and adds */
+    h->v[0] = _mm256_add_epi64(h->v[0], _mm256_add_epi64(c, _mm256_add_epi64(_mm256_slli_epi64(c, 1), _mm256_slli_epi64(c, 4))));
+
+    CARRY(0, 26, mask26);
+#undef CARRY
+}
+
+/*
+    h = f * g in each lane
+    Limbs of f must be below 3 * 2^26 and limbs of g below 2^27.7,
+    so that 19g fits into 32 bits.
+*/
+
+GE_AVX2_TARGET
+static void fe4_mul(fe4 *h, const fe4 *f, const fe4 *g) {
+    const __m256i nineteen = _mm256_set1_epi64x(19);
+    __m256i f2[10];
+    __m256i g19[10];
+    __m256i r[10];
+    int i;
+    int k;
+
+    for (i = 0; i < 10; ++i) {
+        f2[i] = (i & 1) ? _mm256_add_epi64(f->v[i], f->v[i]) : f->v[i];
+        g19[i] = _mm256_mul_epu32(g->v[i], nineteen);
+        r[i] = _mm256_setzero_si256();
+    }
+
+    /* f_i g_j has weight 2^(w_i + w_j), which is twice 2^w_(i+j) if i and j are odd */
+#pragma GCC unroll 10
+    for (k = 0; k < 10; ++k) {
+#pragma GCC unroll 10
+        for (i = 0; i < 10; ++i) {
+            int j = (k - i + 10) % 10;
+            __m256i a = (i & j & 1) ? f2[i] : f->v[i];
+            __m256i b = (i <= k) ? g->v[j] : g19[j];
+            r[k] = _mm256_add_epi64(r[k], _mm256_mul_epu32(a, b));
+        }
+    }
+
+    for (i = 0; i < 10; ++i) {
+        h->v[i] = r[i];
+    }
+    fe4_carry(h);
+}
+
+/*
+    h = f * f in each lane
+    Limbs of f must be below 2^27.
+*/
+
+GE_AVX2_TARGET
+static void fe4_sq(fe4 *h, const fe4 *f) {
+    const __m256i nineteen = _mm256_set1_epi64x(19);
+    __m256i fm[3][10];
+    __m256i f19[10];
+    __m256i r[10];
+    int i;
+    int k;
+
+    for (i = 0; i < 10; ++i) {
+        fm[0][i] = f->v[i];
+        fm[1][i] = _mm256_add_epi64(f->v[i], f->v[i]);
+        fm[2][i] = _mm256_add_epi64(fm[1][i], fm[1][i]);
+        f19[i] = _mm256_mul_epu32(f->v[i], nineteen);
+        r[i] = _mm256_setzero_si256();
+    }
+
+    /* f_i f_j for i < j appears twice, and again twice as much if i and j are odd */
+#pragma GCC unroll 10
+    for (k = 0; k < 10; ++k) {
+#pragma GCC unroll 10
+        for (i = 0; i < 10; ++i) {
+            int j = (k - i + 10) % 10;
+            if (i <= j) {
+                __m256i a = fm[(i < j) + (i & j & 1)][i];
+                __m256i b = (i <= k) ? f->v[j] : f19[j];
+                r[k] = _mm256_add_epi64(r[k], _mm256_mul_epu32(a, b));
+            }
+        }
+    }
+
+    for (i = 0; i < 10; ++i) {
+        h->v[i] = r[i];
+    }
+    fe4_carry(h);
+}
+
+/* r = a + b */
+GE_AVX2_TARGET
+static void fe4_add(fe4 *r, const fe4 *a, const fe4 *b) {
+    int i;
+
+    for (i = 0; i < 10; ++i) {
+        r->v[i] = _mm256_add_epi64(a->v[i], b->v[i]);
+    }
+}
+
+/* r = -a, as 2p - a */
+GE_AVX2_TARGET
+static void fe4_neg(fe4 *r, const fe4 *a) {
+    int i;
+
+    for (i = 0; i < 10; ++i) {
+        r->v[i] = _mm256_sub_epi64(_mm256_set1_epi64x((long long) fe4_2p[i]), a->v[i]);
+    }
+}
+
+/*
+    Lane moves with immediate operands, as macros so that the immediates
+    survive unoptimized builds. Lanes are named A, B, C, D.
+    FE4_BLEND takes the lanes in mask from b, the others from a,
+    FE4_PERMUTE sets lane k of r to lane ((imm >> 2k) & 3) of a, crossing
+    the 128 bit halves, FE4_SWAP exchanges A with B and C with D.
+*/
+#define FE4_A 0x03
+#define FE4_B 0x0c
+#define FE4_C 0x30
+#define FE4_D 0xc0
+
+#define FE4_LOOP(r, expr) do { \
+        int i_; \
+        for (i_ = 0; i_ < 10; ++i_) (r)->v[i_] = (expr); \
+    } while (0)
+
+#define FE4_BLEND(r, a, b, mask) FE4_LOOP(r, _mm256_blend_epi32((a)->v[i_], (b)->v[i_], mask))
+#define FE4_PERMUTE(r, a, imm) FE4_LOOP(r, _mm256_permute4x64_epi64((a)->v[i_], imm))
+#define FE4_SWAP(r, a) FE4_LOOP(r, _mm256_shuffle_epi32((a)->v[i_], 0x4e))
+
+/* (A, B, C, D) -> (B - A, A + B, D - C, C + D), for carried limbs */
+GE_AVX2_INLINE
+static void fe4_diff_sum(fe4 *r, const fe4 *a) {
+    fe4 n, s;
+
+    fe4_neg(&n, a);
+    FE4_BLEND(&n, a, &n, FE4_A | FE4_C);
+    FE4_SWAP(&s, a);
+    fe4_add(r, &s, &n);
+}
+
+/*
+    p = 2p
+    With S1 ... S4 = X^2, Y^2, Z^2, (X + Y)^2, the completed point of ref10's
+    ge_p2_dbl is ((S4 - S1 - S2 : S2 - S1), (S1 + S2 : 2S3 - S2 + S1)). All
+    four coordinates of the result are negated, which is the same point.
+*/
+
+GE_AVX2_TARGET
+static void ge4_dbl(fe4 *p) {
+    fe4 s, t, w;
+
+    /* (X, Y, Z, X + Y) */
+    FE4_PERMUTE(&t, p, 0x44);
+    FE4_SWAP(&s, &t);
+    fe4_add(&t, &t, &s);
+    FE4_BLEND(&s, p, &t, FE4_D);
+    fe4_sq(&s, &s);
+
+    /* w = (S1 + S2, S1 - S2, S1 - S2 + 2S3, S1 + S2 - S4) */
+    fe4_add(&t, &s, &s);
+    fe4_neg(&w, &s);
+    FE4_BLEND(&w, &t, &w, FE4_D);
+    FE4_PERMUTE(&t, &s, 0x00);
+    fe4_add(&w, &w, &t);
+    FE4_BLEND(&w, &t, &w, FE4_C | FE4_D);
+    FE4_PERMUTE(&t, &s, 0x55);
+    fe4_neg(&s, &t);
+    FE4_BLEND(&t, &t, &s, FE4_B | FE4_C);
+    fe4_add(&w, &w, &t);
+    fe4_carry(&w);
+
+    /* (wD, wA, wB, wD) * (wC, wB, wC, wA) */
+    FE4_PERMUTE(&s, &w, 0xd3);
+    FE4_PERMUTE(&t, &w, 0x26);
+    fe4_mul(p, &s, &t);
+}
+
+/* p = p + q, or p = p - q if negate is set */
+GE_AVX2_TARGET
+static void ge4_add(fe4 *p, const fe4_packed *q, int negate) {
+    fe4 c, s, t;
+
+    fe4_unpack(&c, q);
+    if (negate) {
+        /* -q = (Y + X, Y - X, 2Z, -2dT) */
+        fe4_neg(&t, &c);
+        FE4_BLEND(&t, &c, &t, FE4_D);
+        FE4_SWAP(&s, &c);
+        FE4_BLEND(&c, &s, &t, FE4_C | FE4_D);
+    }
+
+    /* (Y1 - X1, Y1 + X1, Z1, T1) * (Y2 - X2, Y2 + X2, 2Z2, 2dT2) = (A, B, C, D) */
+    fe4_diff_sum(&s, p);
+    FE4_BLEND(&s, p, &s, FE4_A | FE4_B);
+    fe4_mul(&s, &s, &c);
+
+    /* (B - A, B + A, C - D, C + D) = (E, H, F, G) */
+    FE4_SWAP(&t, &s);
+    FE4_BLEND(&s, &s, &t, FE4_C | FE4_D);
+    fe4_diff_sum(&s, &s);
+
+    /* (E, G, G, E) * (F, H, F, H) */
+    FE4_PERMUTE(&t, &s, 0x3c);
+    FE4_PERMUTE(&c, &s, 0x66);
+    fe4_mul(p, &t, &c);
+}
+
+GE_AVX2_TARGET
+static void ge4_cached_pack(fe4_packed *r, const fe yminusx, const fe yplusx, const fe z, const fe t2d) {
+    fe4 c;
+    fe z2;
+
+    fe_add(z2, z, z);
+    fe4_load(&c, yminusx, yplusx, z2, t2d);
+    fe4_carry(&c);
+    fe4_pack(r, &c);
+}
+
+/* (0, 1, 1, 0) */
+GE_AVX2_TARGET
+static void ge4_0(fe4 *p) {
+    int i;
+
+    for (i = 0; i < 10; ++i) {
+        p->v[i] = _mm256_setzero_si256();
+    }
+    p->v[0] = _mm256_set_epi64x(0, 1, 1, 0);
+}
+
+static int ge_avx2_supported_cache = -1;
+
+int ge_avx2_supported(void) {
+    if (ge_avx2_supported_cache < 0) {
+        ge_avx2_supported_cache = (nimiq_cpu_features() & NIMIQ_CPU_AVX2) != 0;
+    }
+    return ge_avx2_supported_cache;
+}
+
+GE_AVX2_TARGET
+void ge_avx2_double_scalarmult_vartime(ge_p2 *r, const signed char *aslide, const ge_cached *Ai,
+                                       const signed char *bslide, const ge_precomp *Bi, int top) {
+    fe4_packed A[8];
+    fe4_packed B[8];
+    fe4 p;
+    fe one;
+    int i;
+
+    fe_1(one);
+    for (i = 0; i < 8; ++i) {
+        ge4_cached_pack(&A[i], Ai[i].YminusX, Ai[i].YplusX, Ai[i].Z, Ai[i].T2d);
+        ge4_cached_pack(&B[i], Bi[i].yminusx, Bi[i].yplusx, one, Bi[i].xy2d);
+    }
+    ge4_0(&p);
+
+    for (i = top; i >= 0; --i) {
+        ge4_dbl(&p);
+
+        if (aslide[i] > 0) {
+            ge4_add(&p, &A[aslide[i] / 2], 0);
+        } else if (aslide[i] < 0) {
+            ge4_add(&p, &A[(-aslide[i]) / 2], 1);
+        }
+
+        if (bslide[i] > 0) {
+            ge4_add(&p, &B[bslide[i] / 2], 0);
+        } else if (bslide[i] < 0) {
+            ge4_add(&p, &B[(-bslide[i]) / 2], 1);
+        }
+    }
+
+    fe4_store(r->X, r->Y, r->Z, &p);
+}
+
+GE_AVX2_TARGET
+void ge_avx2_multi_scalarmult_vartime(ge_p2 *r, const signed char (*slides)[256], const ge_cached (*Ai)[8],
+                                      size_t n, int top) {
+    fe4_packed A[GE_MULTI_SIZE][8];
+    fe4 p;
+    size_t j;
+    int i;
+
+    for (j = 0; j < n; ++j) {
+        for (i = 0; i < 8; ++i) {
+            ge4_cached_pack(&A[j][i], Ai[j][i].YminusX, Ai[j][i].YplusX, Ai[j][i].Z, Ai[j][i].T2d);
+        }
+    }
+    ge4_0(&p);
+
+    for (i = top; i >= 0; --i) {
+        ge4_dbl(&p);
+
+        for (j = 0; j < n; ++j) {
+            if (slides[j][i] > 0) {
+                ge4_add(&p, &A[j][slides[j][i] / 2], 0);
+            } else if (slides[j][i] < 0) {
+                ge4_add(&p, &A[j][(-slides[j][i]) / 2], 1);
+            }
+        }
+    }
+
+    fe4_store(r->X, r->Y, r->Z, &p);
+}
+
+/* h = f^(2^n) in each lane */
+GE_AVX2_TARGET
+static void fe4_sq_times(fe4 *h, const fe4 *f, int n) {
+    int i;
+
+    fe4_sq(h, f);
+    for (i = 1; i < n; ++i) {
+        fe4_sq(h, h);
+    }
+}
+
+/* The addition chain of fe_pow22523, in each lane. */
+GE_AVX2_TARGET
+void ge_avx2_pow22523(fe *out, const fe *z) {
+    fe4 t0;
+    fe4 t1;
+    fe4 t2;
+    fe4 zv;
+
+    fe4_load(&zv, z[0], z[1], z[2], z[3]);
+    fe4_sq(&t0, &zv);
+    fe4_sq_times(&t1, &t0, 2);
+    fe4_mul(&t1, &zv, &t1);
+    fe4_mul(&t0, &t0, &t1);
+    fe4_sq(&t0, &t0);
+    fe4_mul(&t0, &t1, &t0);         /* z^(2^5 - 1) */
+    fe4_sq_times(&t1, &t0, 5);
+    fe4_mul(&t0, &t1, &t0);         /* z^(2^10 - 1) */
+    fe4_sq_times(&t1, &t0, 10);
+    fe4_mul(&t1, &t1, &t0);         /* z^(2^20 - 1) */
+    fe4_sq_times(&t2, &t1, 20);
+    fe4_mul(&t1, &t2, &t1);         /* z^(2^40 - 1) */
+    fe4_sq_times(&t1, &t1, 10);
+    fe4_mul(&t0, &t1, &t0);         /* z^(2^50 - 1) */
+    fe4_sq_times(&t1, &t0, 50);
+    fe4_mul(&t1, &t1, &t0);         /* z^(2^100 - 1) */
+    fe4_sq_times(&t2, &t1, 100);
+    fe4_mul(&t1, &t2, &t1);         /* z^(2^200 - 1) */
+    fe4_sq_times(&t1, &t1, 50);
+    fe4_mul(&t0, &t1, &t0);         /* z^(2^250 - 1) */
+    fe4_sq_times(&t0, &t0, 2);
+    fe4_mul(&t0, &t0, &zv);         /* z^(2^252 - 3) */
+    fe4_store_lanes(out, &t0);
+}
+
+#endif
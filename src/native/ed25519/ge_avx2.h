@@ -0,0 +1,35 @@
+#ifndef GE_AVX2_H
+#define GE_AVX2_H
+
+#include "ge.h"
+#include "cpu.h"
+
+/*
+    Variable time scalar multiplications with the four coordinates of a point
+    in the lanes of AVX2 vectors, so that the four field multiplications of
+    each step of a point addition or doubling run in parallel.
+    The exponentiation of point decompression runs four points at a time
+    in the same way, with one point in each lane.
+    Built on x86-64 next to the radix 2^51 field code and used if the
+    processor supports AVX2 (see ge_avx2_supported).
+*/
+
+#if defined(NIMIQ_CPU_X86) && defined(__x86_64__) && defined(ED25519_FE51)
+#define GE_AVX2
+
+int ge_avx2_supported(void);
+
+/*
+    The loops of ge_double_scalarmult_vartime_cached and ge_multi_scalarmult_vartime,
+    for the signed sliding windows computed there, starting at bit top.
+*/
+void ge_avx2_double_scalarmult_vartime(ge_p2 *r, const signed char *aslide, const ge_cached *Ai,
+                                       const signed char *bslide, const ge_precomp *Bi, int top);
+void ge_avx2_multi_scalarmult_vartime(ge_p2 *r, const signed char (*slides)[256], const ge_cached (*Ai)[8],
+                                      size_t n, int top);
+
+/* out[k] = z[k]^((q-5)/8) for k = 0, ..., 3, as in fe_pow22523 */
+void ge_avx2_pow22523(fe *out, const fe *z);
+#endif
+
+#endif
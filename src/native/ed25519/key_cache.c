@@ -0,0 +1,159 @@
+#include <string.h>
+
+#include "key_cache.h"
+#include "lock.h"
+
+typedef struct {
+    key_cache_entry entry;
+    uint64_t last_used; /* 0 if the slot is empty */
+} key_cache_slot;
+
+static key_cache_slot cache[KEY_CACHE_SETS][KEY_CACHE_WAYS];
+static ed25519_lock_t cache_lock = ED25519_LOCK_INIT;
+static uint64_t cache_clock = 0;
+static uint64_t cache_hits = 0;
+static uint64_t cache_misses = 0;
+
+static size_t key_cache_set(const unsigned char *public_key) {
+    uint32_t x = (uint32_t) public_key[0] | ((uint32_t) public_key[1] << 8) | ((uint32_t) public_key[2] << 16) | ((uint32_t) public_key[3] << 24);
+    return (size_t) ((x * 2654435761u) >> 24) % KEY_CACHE_SETS;
+}
+
+/* Returns 1 and copies the entry of public_key if it is cached, 0 otherwise. */
+static int key_cache_lookup(key_cache_entry *entry, const unsigned char *public_key) {
+    key_cache_slot *set = cache[key_cache_set(public_key)];
+    size_t i;
+
+    for (i = 0; i < KEY_CACHE_WAYS; ++i) {
+        if (set[i].last_used && memcmp(set[i].entry.public_key, public_key, 32) == 0) {
+            set[i].last_used = ++cache_clock;
+            *entry = set[i].entry;
+            cache_hits++;
+            return 1;
+        }
+    }
+    cache_misses++;
+    return 0;
+}
+
+/* Inserts a decoded entry, replacing the least recently used one of its set. */
+static void key_cache_insert(const key_cache_entry *entry) {
+    key_cache_slot *set = cache[key_cache_set(entry->public_key)];
+    key_cache_slot *victim = &set[0];
+    size_t i;
+
+    for (i = 0; i < KEY_CACHE_WAYS; ++i) {
+        if (set[i].last_used && memcmp(set[i].entry.public_key, entry->public_key, 32) == 0) {
+            victim = &set[i];
+            break;
+        }
+        if (set[i].last_used < victim->last_used) {
+            victim = &set[i];
+        }
+    }
+    victim->entry = *entry;
+    victim->last_used = ++cache_clock;
+}
+
+/*
+Decodes public_key into entry, through the cache. Returns 0 on success and -1
+if public_key is not a valid point, in which case it is not cached.
+*/
+
+int key_cache_get(key_cache_entry *entry, const unsigned char *public_key) {
+    int found;
+
+    ed25519_lock(&cache_lock);
+    found = key_cache_lookup(entry, public_key);
+    ed25519_unlock(&cache_lock);
+    if (found) {
+        return 0;
+    }
+
+    /* Decode outside of the lock, other threads may insert the same key meanwhile. */
+    if (ge_frombytes_negate_vartime(&entry->A, public_key) != 0) {
+        return -1;
+    }
+    ge_p3_odd_multiples(entry->Ai, &entry->A);
+    memcpy(entry->public_key, public_key, 32);
+
+    ed25519_lock(&cache_lock);
+    key_cache_insert(entry);
+    ed25519_unlock(&cache_lock);
+    return 0;
+}
+
+/*
+Stores the odd multiples of the negated points of the n keys public_keys[0..32n)
+to Ai, through the cache. The keys that are not cached are decoded together
+with ge_frombytes_many_vartime. Stores 1 to valid[i] if the i-th key is a valid
+point and 0 otherwise, in which case Ai[i] is undefined. Returns the number of
+valid keys.
+*/
+
+size_t key_cache_get_many(ge_cached (*Ai)[8], unsigned char *valid, const unsigned char *public_keys, size_t n) {
+    key_cache_entry entry;
+    ge_p3 A[GE_BATCH_SIZE];
+    unsigned char encoded[GE_BATCH_SIZE][32];
+    unsigned char decoded[GE_BATCH_SIZE];
+    size_t missing[GE_BATCH_SIZE];
+    size_t count = 0;
+    size_t chunk;
+    size_t misses;
+    size_t i;
+
+    for ( ; n > 0; n -= chunk) {
+        chunk = n < GE_BATCH_SIZE ? n : GE_BATCH_SIZE;
+        misses = 0;
+
+        ed25519_lock(&cache_lock);
+        for (i = 0; i < chunk; ++i) {
+            if (key_cache_lookup(&entry, public_keys + 32 * i)) {
+                memcpy(Ai[i], entry.Ai, sizeof(entry.Ai));
+                valid[i] = 1;
+                count++;
+            } else {
+                memcpy(encoded[misses], public_keys + 32 * i, 32);
+                missing[misses++] = i;
+            }
+        }
+        ed25519_unlock(&cache_lock);
+
+        ge_frombytes_many_vartime(A, decoded, encoded[0], misses, 1);
+        for (i = 0; i < misses; ++i) {
+            valid[missing[i]] = decoded[i];
+            if (!decoded[i]) continue;
+
+            entry.A = A[i];
+            ge_p3_odd_multiples(entry.Ai, &A[i]);
+            memcpy(entry.public_key, encoded[i], 32);
+            memcpy(Ai[missing[i]], entry.Ai, sizeof(entry.Ai));
+            count++;
+
+            ed25519_lock(&cache_lock);
+            key_cache_insert(&entry);
+            ed25519_unlock(&cache_lock);
+        }
+
+        Ai += chunk;
+        valid += chunk;
+        public_keys += 32 * chunk;
+    }
+
+    return count;
+}
+
+void key_cache_stats(uint64_t *hits, uint64_t *misses) {
+    ed25519_lock(&cache_lock);
+    *hits = cache_hits;
+    *misses = cache_misses;
+    ed25519_unlock(&cache_lock);
+}
+
+void key_cache_clear(void) {
+    ed25519_lock(&cache_lock);
+    memset(cache, 0, sizeof(cache));
+    cache_hits = 0;
+    cache_misses = 0;
+    ed25519_unlock(&cache_lock);
+}
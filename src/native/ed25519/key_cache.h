@@ -0,0 +1,26 @@
+#ifndef KEY_CACHE_H
+#define KEY_CACHE_H
+
+#include "fixedint.h"
+#include "ge.h"
+
+/*
+Bounded cache of decoded public keys, shared by all threads. Lookups copy
+the entry, so it stays valid when the cache evicts the key afterwards.
+*/
+
+#define KEY_CACHE_SETS 256
+#define KEY_CACHE_WAYS 4 /* KEY_CACHE_SETS * KEY_CACHE_WAYS keys, about 1.5 KiB each */
+
+typedef struct {
+    unsigned char public_key[32];
+    ge_p3 A;         /* the negated point, as decoded by ge_frombytes_negate_vartime */
+    ge_cached Ai[8]; /* odd multiples of A, see ge_p3_odd_multiples */
+} key_cache_entry;
+
+int key_cache_get(key_cache_entry *entry, const unsigned char *public_key);
+size_t key_cache_get_many(ge_cached (*Ai)[8], unsigned char *valid, const unsigned char *public_keys, size_t n);
+void key_cache_stats(uint64_t *hits, uint64_t *misses);
+void key_cache_clear(void);
+
+#endif
@@ -19,4 +19,30 @@ void ed25519_public_key_derive(unsigned char *out_public_key, const unsigned cha
 
     ge_scalarmult_base(&A,az);
     ge_p3_tobytes(out_public_key, &A);
-}
\ No newline at end of file
+}
+
+/*
+ * Derives the public keys of the n private keys private_keys[0..32n) like
+ * ed25519_public_key_derive. The points are encoded GE_BATCH_SIZE at a time
+ * with a single field inversion.
+ */
+
+void ed25519_public_keys_derive(unsigned char *public_keys, const unsigned char *private_keys, size_t n) {
+    unsigned char az[64];
+    ge_p3 A[GE_BATCH_SIZE];
+    size_t chunk;
+    size_t i;
+
+    for ( ; n > 0; n -= chunk) {
+        chunk = n < GE_BATCH_SIZE ? n : GE_BATCH_SIZE;
+
+        for (i = 0; i < chunk; ++i) {
+            ed25519_private_key_decompress(az, private_keys + 32 * i);
+            ge_scalarmult_base(&A[i], az);
+        }
+        ge_p3_batch_tobytes(public_keys, A, chunk);
+
+        public_keys += 32 * chunk;
+        private_keys += 32 * chunk;
+    }
+}
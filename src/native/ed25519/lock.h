@@ -0,0 +1,65 @@
+#ifndef LOCK_H
+#define LOCK_H
+
+/*
+Mutex and one-time initialisation for state shared by the threads of the
+native thread pool: Windows primitives on _WIN32, pthreads elsewhere.
+*/
+
+#if defined(_WIN32)
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+typedef SRWLOCK ed25519_lock_t;
+#define ED25519_LOCK_INIT SRWLOCK_INIT
+
+typedef INIT_ONCE ed25519_once_t;
+#define ED25519_ONCE_INIT INIT_ONCE_STATIC_INIT
+
+static inline void ed25519_lock(ed25519_lock_t *lock) {
+    AcquireSRWLockExclusive(lock);
+}
+
+static inline void ed25519_unlock(ed25519_lock_t *lock) {
+    ReleaseSRWLockExclusive(lock);
+}
+
+static inline BOOL CALLBACK ed25519_once_callback(PINIT_ONCE once, PVOID init, PVOID *context) {
+    (void) once;
+    (void) context;
+    (*(void (**)(void)) init)();
+    return TRUE;
+}
+
+static inline void ed25519_once(ed25519_once_t *once, void (*init)(void)) {
+    InitOnceExecuteOnce(once, ed25519_once_callback, (PVOID) &init, NULL);
+}
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_mutex_t ed25519_lock_t;
+#define ED25519_LOCK_INIT PTHREAD_MUTEX_INITIALIZER
+
+typedef pthread_once_t ed25519_once_t;
+#define ED25519_ONCE_INIT PTHREAD_ONCE_INIT
+
+static inline void ed25519_lock(ed25519_lock_t *lock) {
+    pthread_mutex_lock(lock);
+}
+
+static inline void ed25519_unlock(ed25519_lock_t *lock) {
+    pthread_mutex_unlock(lock);
+}
+
+static inline void ed25519_once(ed25519_once_t *once, void (*init)(void)) {
+    pthread_once(once, init);
+}
+
+#endif
+
+#endif
@@ -1,6 +1,9 @@
+#include <string.h>
 #include "fixedint.h"
 #include "sc.h"
 
+#ifndef ED25519_SC64
+
 static uint64_t load_3(const unsigned char *in) {
     uint64_t result;
 
@@ -346,6 +349,8 @@ void sc_reduce(unsigned char *s) {
     s[31] = (unsigned char) (s11 >> 17);
 }
 
+#endif
+
 /*
 Input:
   s[0]+256*s[1]+...+256^31*s[31] = s
@@ -396,6 +401,7 @@ int sc_valid_reduction(const unsigned char *s) {
     return !!r;
 }
 
+#ifndef ED25519_SC64
 
 /*
 Input:
@@ -856,3 +862,25 @@ void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b,
     s[30] = (unsigned char) (s11 >> 9);
     s[31] = (unsigned char) (s11 >> 17);
 }
+
+void sc_mul_many(unsigned char (*s)[32], const unsigned char (*a)[32], const unsigned char (*b)[32], size_t n) {
+    static const unsigned char zero[32] = {0};
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        sc_muladd(s[i], a[i], b[i], zero);
+    }
+}
+
+void sc_inner_product(unsigned char *s, const unsigned char (*a)[32], const unsigned char (*b)[32], size_t n) {
+    unsigned char sum[32] = {0};
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        sc_muladd(sum, a[i], b[i], sum);
+    }
+
+    memcpy(s, sum, 32);
+}
+
+#endif
@@ -1,13 +1,29 @@
 #ifndef SC_H
 #define SC_H
 
+#include <stddef.h>
+
 /*
 The set of scalars is \Z/l
 where l = 2^252 + 27742317777372353535851937790883648493.
 */
 
+/*
+    64-bit targets with 128 bit multiplication use the 64 bit limb Barrett
+    reduction in sc64.c for sc_reduce and sc_muladd, everything else the
+    ref10 code in sc.c. Define ED25519_NO_SC64 to force the ref10 code.
+*/
+#if defined(__SIZEOF_INT128__) && (defined(__x86_64__) || defined(__aarch64__)) && !defined(ED25519_NO_SC64)
+#define ED25519_SC64
+#endif
+
 void sc_reduce(unsigned char *s);
 int sc_valid_reduction(const unsigned char *s);
 void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b, const unsigned char *c);
 
+/* s[i] = a[i] * b[i] mod l */
+void sc_mul_many(unsigned char (*s)[32], const unsigned char (*a)[32], const unsigned char (*b)[32], size_t n);
+/* s = a[0] * b[0] + ... + a[n-1] * b[n-1] mod l, in variable time, for public scalars only */
+void sc_inner_product(unsigned char *s, const unsigned char (*a)[32], const unsigned char (*b)[32], size_t n);
+
 #endif
@@ -0,0 +1,337 @@
+#include "fixedint.h"
+#include "sc.h"
+
+#ifdef ED25519_SC64
+
+/*
+    Scalar arithmetic with four 64 bit limbs for 64-bit targets, see sc.h.
+    Products are accumulated in 128 bit and reduced mod l with Barrett's
+    method for base 2^64, so that a reduction takes two multiplications
+    by constants instead of ref10's carry chains over 21 bit limbs.
+    Everything runs in constant time except sc_inner_product, which is only
+    used on public scalars.
+*/
+
+typedef unsigned __int128 uint128_t;
+
+/* l = 2^252 + c */
+#define SC64_C0 0x5812631a5cf5d3edULL
+#define SC64_C1 0x14def9dea2f79cd6ULL
+
+/* mu = floor(2^512 / l) = 2^260 - m */
+#define SC64_M0 0x12631a5cf5d3ece5ULL
+#define SC64_M1 0xdef9dea2f79cd658ULL
+#define SC64_M2 0x0000000000000014ULL
+
+static const uint64_t L[5] = {
+    SC64_C0, SC64_C1, 0, 0x1000000000000000ULL, 0
+};
+
+/* Products are summed column by column in the 192 bit accumulator (c0, c1, c2). */
+#define MULADD(a, b) do { \
+    uint128_t t = (uint128_t) (a) * (b); \
+    uint64_t th = (uint64_t) (t >> 64); \
+    uint64_t tl = (uint64_t) t; \
+    c0 += tl; \
+    th += (c0 < tl); \
+    c1 += th; \
+    c2 += (c1 < th); \
+} while (0)
+
+#define EXTRACT(n) do { \
+    (n) = c0; \
+    c0 = c1; \
+    c1 = c2; \
+    c2 = 0; \
+} while (0)
+
+static uint64_t load_8(const unsigned char *in) {
+    uint64_t result;
+
+    result = (uint64_t) in[0];
+    result |= ((uint64_t) in[1]) << 8;
+    result |= ((uint64_t) in[2]) << 16;
+    result |= ((uint64_t) in[3]) << 24;
+    result |= ((uint64_t) in[4]) << 32;
+    result |= ((uint64_t) in[5]) << 40;
+    result |= ((uint64_t) in[6]) << 48;
+    result |= ((uint64_t) in[7]) << 56;
+
+    return result;
+}
+
+static void store_8(unsigned char *out, uint64_t in) {
+    out[0] = (unsigned char) in;
+    out[1] = (unsigned char) (in >> 8);
+    out[2] = (unsigned char) (in >> 16);
+    out[3] = (unsigned char) (in >> 24);
+    out[4] = (unsigned char) (in >> 32);
+    out[5] = (unsigned char) (in >> 40);
+    out[6] = (unsigned char) (in >> 48);
+    out[7] = (unsigned char) (in >> 56);
+}
+
+static void sc64_load(uint64_t *r, const unsigned char *s, int n) {
+    int i;
+
+    for (i = 0; i < n; ++i) {
+        r[i] = load_8(s + 8 * i);
+    }
+}
+
+static void sc64_store(unsigned char *s, const uint64_t *r) {
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        store_8(s + 8 * i, r[i]);
+    }
+}
+
+/* r = a * b */
+static void sc64_mul(uint64_t r[8], const uint64_t a[4], const uint64_t b[4]) {
+    uint64_t c0 = 0, c1 = 0, c2 = 0;
+
+    MULADD(a[0], b[0]);
+    EXTRACT(r[0]);
+    MULADD(a[0], b[1]);
+    MULADD(a[1], b[0]);
+    EXTRACT(r[1]);
+    MULADD(a[0], b[2]);
+    MULADD(a[1], b[1]);
+    MULADD(a[2], b[0]);
+    EXTRACT(r[2]);
+    MULADD(a[0], b[3]);
+    MULADD(a[1], b[2]);
+    MULADD(a[2], b[1]);
+    MULADD(a[3], b[0]);
+    EXTRACT(r[3]);
+    MULADD(a[1], b[3]);
+    MULADD(a[2], b[2]);
+    MULADD(a[3], b[1]);
+    EXTRACT(r[4]);
+    MULADD(a[2], b[3]);
+    MULADD(a[3], b[2]);
+    EXTRACT(r[5]);
+    MULADD(a[3], b[3]);
+    EXTRACT(r[6]);
+    r[7] = c0;
+}
+
+/*
+    r = x mod l for x < 2^512, with Barrett's method: q = floor(floor(x / 2^192) * mu / 2^320)
+    is at most 2 below floor(x / l), so x - ql < 3l fits into five limbs and at most two
+    subtractions of l remain. The short m = 2^260 - mu and c = l - 2^252 keep the products small.
+*/
+static void sc64_barrett(uint64_t r[4], const uint64_t x[8]) {
+    const uint64_t *q1 = x + 3;
+    uint64_t p[8];
+    uint64_t q[5];
+    uint64_t t[5];
+    uint64_t d[5];
+    uint64_t c0 = 0, c1 = 0, c2 = 0;
+    uint128_t acc;
+    uint64_t borrow;
+    uint64_t mask;
+    int i;
+    int k;
+
+    /* p = q1 * m */
+    MULADD(q1[0], SC64_M0);
+    EXTRACT(p[0]);
+    MULADD(q1[0], SC64_M1);
+    MULADD(q1[1], SC64_M0);
+    EXTRACT(p[1]);
+    MULADD(q1[0], SC64_M2);
+    MULADD(q1[1], SC64_M1);
+    MULADD(q1[2], SC64_M0);
+    EXTRACT(p[2]);
+    MULADD(q1[1], SC64_M2);
+    MULADD(q1[2], SC64_M1);
+    MULADD(q1[3], SC64_M0);
+    EXTRACT(p[3]);
+    MULADD(q1[2], SC64_M2);
+    MULADD(q1[3], SC64_M1);
+    MULADD(q1[4], SC64_M0);
+    EXTRACT(p[4]);
+    MULADD(q1[3], SC64_M2);
+    MULADD(q1[4], SC64_M1);
+    EXTRACT(p[5]);
+    MULADD(q1[4], SC64_M2);
+    EXTRACT(p[6]);
+    p[7] = c0;
+
+    /* q = (q1 * 2^260 - p) / 2^320, the limbs below 2^256 only contribute a borrow */
+    borrow = (p[0] | p[1] | p[2] | p[3]) != 0;
+    for (i = 4; i < 10; ++i) {
+        uint64_t shifted = (i < 9 ? q1[i - 4] << 4 : 0) | (i > 4 ? q1[i - 5] >> 60 : 0);
+        acc = (uint128_t) shifted - (i < 8 ? p[i] : 0) - borrow;
+        if (i > 4) {
+            q[i - 5] = (uint64_t) acc;
+        }
+        borrow = (uint64_t) (acc >> 64) & 1;
+    }
+
+    /* t = q * l mod 2^320 = q * c + q * 2^252 mod 2^320 */
+    c0 = 0;
+    c1 = 0;
+    MULADD(q[0], SC64_C0);
+    EXTRACT(t[0]);
+    MULADD(q[0], SC64_C1);
+    MULADD(q[1], SC64_C0);
+    EXTRACT(t[1]);
+    MULADD(q[1], SC64_C1);
+    MULADD(q[2], SC64_C0);
+    EXTRACT(t[2]);
+    MULADD(q[2], SC64_C1);
+    MULADD(q[3], SC64_C0);
+    EXTRACT(t[3]);
+    MULADD(q[3], SC64_C1);
+    MULADD(q[4], SC64_C0);
+    t[4] = c0;
+    acc = (uint128_t) t[3] + (q[0] << 60);
+    t[3] = (uint64_t) acc;
+    t[4] += (uint64_t) (acc >> 64) + ((q[1] << 60) | (q[0] >> 4));
+
+    /* d = x - t mod 2^320 */
+    borrow = 0;
+    for (i = 0; i < 5; ++i) {
+        acc = (uint128_t) x[i] - t[i] - borrow;
+        d[i] = (uint64_t) acc;
+        borrow = (uint64_t) (acc >> 64) & 1;
+    }
+
+    for (k = 0; k < 2; ++k) {
+        /* subtract l unless that borrows */
+        borrow = 0;
+        for (i = 0; i < 5; ++i) {
+            acc = (uint128_t) d[i] - L[i] - borrow;
+            t[i] = (uint64_t) acc;
+            borrow = (uint64_t) (acc >> 64) & 1;
+        }
+        mask = borrow - 1;
+        for (i = 0; i < 5; ++i) {
+            d[i] = (t[i] & mask) | (d[i] & ~mask);
+        }
+    }
+
+    for (i = 0; i < 4; ++i) {
+        r[i] = d[i];
+    }
+}
+
+/* x = x + y for 8 limbs x and 4 limbs y, with x + y < 2^512 */
+static void sc64_add_wide(uint64_t x[8], const uint64_t y[4]) {
+    uint128_t acc;
+    uint64_t carry = 0;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        acc = (uint128_t) x[i] + (i < 4 ? y[i] : 0) + carry;
+        x[i] = (uint64_t) acc;
+        carry = (uint64_t) (acc >> 64);
+    }
+}
+
+/*
+Input:
+  s[0]+256*s[1]+...+256^63*s[63] = s
+
+Output:
+  s[0]+256*s[1]+...+256^31*s[31] = s mod l
+  Overwrites s in place.
+*/
+
+void sc_reduce(unsigned char *s) {
+    uint64_t x[8];
+    uint64_t r[4];
+
+    sc64_load(x, s, 8);
+    sc64_barrett(r, x);
+    sc64_store(s, r);
+}
+
+/*
+Output:
+  s[0]+256*s[1]+...+256^31*s[31] = (ab+c) mod l
+  for 256 bit a, b and c.
+*/
+
+void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b, const unsigned char *c) {
+    uint64_t a64[4];
+    uint64_t b64[4];
+    uint64_t c64[4];
+    uint64_t x[8];
+    uint64_t r[4];
+
+    sc64_load(a64, a, 4);
+    sc64_load(b64, b, 4);
+    sc64_load(c64, c, 4);
+    sc64_mul(x, a64, b64);
+    sc64_add_wide(x, c64);
+    sc64_barrett(r, x);
+    sc64_store(s, r);
+}
+
+void sc_mul_many(unsigned char (*s)[32], const unsigned char (*a)[32], const unsigned char (*b)[32], size_t n) {
+    uint64_t a64[4];
+    uint64_t b64[4];
+    uint64_t x[8];
+    uint64_t r[4];
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        sc64_load(a64, a[i], 4);
+        sc64_load(b64, b[i], 4);
+        sc64_mul(x, a64, b64);
+        sc64_barrett(r, x);
+        sc64_store(s[i], r);
+    }
+}
+
+/*
+    The products are summed up without reduction as long as they stay below
+    2^448, e.g. 128 bit randomizers times reduced scalars, so a whole batch
+    needs a single reduction. Larger products reduce the sum first.
+    Whether they do depends on the operands, so this runs in variable time
+    and must only be used on public scalars, as in batch verification.
+*/
+void sc_inner_product(unsigned char *s, const unsigned char (*a)[32], const unsigned char (*b)[32], size_t n) {
+    uint64_t a64[4];
+    uint64_t b64[4];
+    uint64_t x[8];
+    uint64_t sum[8] = {0};
+    uint64_t r[4];
+    uint128_t acc;
+    uint64_t carry;
+    size_t i;
+    int j;
+
+    for (i = 0; i < n; ++i) {
+        sc64_load(a64, a[i], 4);
+        sc64_load(b64, b[i], 4);
+        sc64_mul(x, a64, b64);
+
+        if (x[7] | (sum[7] >> 62)) {
+            /* large operands, keep the sum below 2^512 */
+            sc64_barrett(r, sum);
+            for (j = 0; j < 8; ++j) {
+                sum[j] = j < 4 ? r[j] : 0;
+            }
+            sc64_barrett(r, x);
+            sc64_add_wide(sum, r);
+            continue;
+        }
+
+        carry = 0;
+        for (j = 0; j < 8; ++j) {
+            acc = (uint128_t) sum[j] + x[j] + carry;
+            sum[j] = (uint64_t) acc;
+            carry = (uint64_t) (acc >> 64);
+        }
+    }
+
+    sc64_barrett(r, sum);
+    sc64_store(s, r);
+}
+
+#endif
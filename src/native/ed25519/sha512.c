@@ -9,8 +9,11 @@
  * Tom St Denis, tomstdenis@gmail.com, http://libtom.org
  */
 
+#include <string.h>
+
 #include "fixedint.h"
 #include "sha512.h"
+#include "cpu.h"
 
 /* the K array */
 static const uint64_t K[80] = {
@@ -87,54 +90,164 @@ static const uint64_t K[80] = {
    #define MIN(x, y) ( ((x)<(y))?(x):(y) )
 #endif
 
-/* compress 1024-bits */
-static int sha512_compress(sha512_context *md, unsigned char *buf)
+/* compress 1024-bits, for each of the given blocks */
+static void sha512_blocks_ref(uint64_t state[8], const unsigned char *buf, size_t blocks)
 {
     uint64_t S[8], W[80], t0, t1;
     int i;
 
-    /* copy state into S */
-    for (i = 0; i < 8; i++) {
-        S[i] = md->state[i];
-    }
+    for ( ; blocks > 0; blocks--, buf += 128) {
+        /* copy state into S */
+        for (i = 0; i < 8; i++) {
+            S[i] = state[i];
+        }
+
+        /* copy the state into 1024-bits into W[0..15] */
+        for (i = 0; i < 16; i++) {
+            LOAD64H(W[i], buf + (8*i));
+        }
+
+        /* fill W[16..79] */
+        for (i = 16; i < 80; i++) {
+            W[i] = Gamma1(W[i - 2]) + W[i - 7] + Gamma0(W[i - 15]) + W[i - 16];
+        }
+
+        /* Compress */
+        #define RND(a,b,c,d,e,f,g,h,i) \
+        t0 = h + Sigma1(e) + Ch(e, f, g) + K[i] + W[i]; \
+        t1 = Sigma0(a) + Maj(a, b, c);\
+        d += t0; \
+        h  = t0 + t1;
+
+        for (i = 0; i < 80; i += 8) {
+            RND(S[0],S[1],S[2],S[3],S[4],S[5],S[6],S[7],i+0);
+            RND(S[7],S[0],S[1],S[2],S[3],S[4],S[5],S[6],i+1);
+            RND(S[6],S[7],S[0],S[1],S[2],S[3],S[4],S[5],i+2);
+            RND(S[5],S[6],S[7],S[0],S[1],S[2],S[3],S[4],i+3);
+            RND(S[4],S[5],S[6],S[7],S[0],S[1],S[2],S[3],i+4);
+            RND(S[3],S[4],S[5],S[6],S[7],S[0],S[1],S[2],i+5);
+            RND(S[2],S[3],S[4],S[5],S[6],S[7],S[0],S[1],i+6);
+            RND(S[1],S[2],S[3],S[4],S[5],S[6],S[7],S[0],i+7);
+        }
+
+        #undef RND
 
-    /* copy the state into 1024-bits into W[0..15] */
-    for (i = 0; i < 16; i++) {
-        LOAD64H(W[i], buf + (8*i));
+        /* feedback */
+        for (i = 0; i < 8; i++) {
+            state[i] = state[i] + S[i];
+        }
     }
+}
+
+#ifdef NIMIQ_CPU_X86
+#include <immintrin.h>
+
+/* 64 bit rotate right and shift right of both words of a vector */
+#define VROR64(x, n)    _mm_or_si128(_mm_srli_epi64(x, n), _mm_slli_epi64(x, 64 - (n)))
+#define VGamma0(x)      _mm_xor_si128(_mm_xor_si128(VROR64(x, 1), VROR64(x, 8)), _mm_srli_epi64(x, 7))
+#define VGamma1(x)      _mm_xor_si128(_mm_xor_si128(VROR64(x, 19), VROR64(x, 61)), _mm_srli_epi64(x, 6))
+
+/*
+ * compress 1024-bits, for each of the given blocks
+ * The message schedule is computed two words at a time in vector registers,
+ * X[j] holding the last 16 words W[t-16..t-1] and WK[t] = W[t] + K[t] being
+ * consumed by the scalar rounds, which get rorx from BMI2.
+ */
+__attribute__((target("avx2,bmi2")))
+static void sha512_blocks_avx2(uint64_t state[8], const unsigned char *buf, size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x08090a0b0c0d0e0fLL, 0x0001020304050607LL);
+    __m128i X[8], w;
+    uint64_t WK[80] __attribute__((aligned(16)));
+    uint64_t S[8], t0, t1;
+    int i;
+
+    for ( ; blocks > 0; blocks--, buf += 128) {
+        for (i = 0; i < 8; i++) {
+            X[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(buf + 16*i)), bswap);
+            _mm_store_si128((__m128i *)&WK[2*i], _mm_add_epi64(X[i], _mm_loadu_si128((const __m128i *)&K[2*i])));
+        }
+
+        for (i = 0; i < 8; i++) {
+            S[i] = state[i];
+        }
 
-    /* fill W[16..79] */
-    for (i = 16; i < 80; i++) {
-        W[i] = Gamma1(W[i - 2]) + W[i - 7] + Gamma0(W[i - 15]) + W[i - 16];
-    }        
+        #define RND(a,b,c,d,e,f,g,h,i) \
+        t0 = h + Sigma1(e) + Ch(e, f, g) + WK[i]; \
+        t1 = Sigma0(a) + Maj(a, b, c);\
+        d += t0; \
+        h  = t0 + t1;
+
+        /* X[j & 7] = W[2j-16..2j-15] is replaced by W[2j..2j+1] */
+        #define SCHEDULE(j) \
+        w = _mm_add_epi64(X[(j) & 7], VGamma1(X[((j) + 7) & 7])); \
+        w = _mm_add_epi64(w, VGamma0(_mm_alignr_epi8(X[((j) + 1) & 7], X[(j) & 7], 8))); \
+        w = _mm_add_epi64(w, _mm_alignr_epi8(X[((j) + 5) & 7], X[((j) + 4) & 7], 8)); \
+        X[(j) & 7] = w; \
+        _mm_store_si128((__m128i *)&WK[2*(j)], _mm_add_epi64(w, _mm_loadu_si128((const __m128i *)&K[2*(j)])));
+
+        /* the schedule runs 16 words ahead of the rounds */
+        for (i = 0; i < 64; i += 8) {
+            SCHEDULE(i/2 + 8);
+            RND(S[0],S[1],S[2],S[3],S[4],S[5],S[6],S[7],i+0);
+            RND(S[7],S[0],S[1],S[2],S[3],S[4],S[5],S[6],i+1);
+            SCHEDULE(i/2 + 9);
+            RND(S[6],S[7],S[0],S[1],S[2],S[3],S[4],S[5],i+2);
+            RND(S[5],S[6],S[7],S[0],S[1],S[2],S[3],S[4],i+3);
+            SCHEDULE(i/2 + 10);
+            RND(S[4],S[5],S[6],S[7],S[0],S[1],S[2],S[3],i+4);
+            RND(S[3],S[4],S[5],S[6],S[7],S[0],S[1],S[2],i+5);
+            SCHEDULE(i/2 + 11);
+            RND(S[2],S[3],S[4],S[5],S[6],S[7],S[0],S[1],i+6);
+            RND(S[1],S[2],S[3],S[4],S[5],S[6],S[7],S[0],i+7);
+        }
+        for ( ; i < 80; i += 8) {
+            RND(S[0],S[1],S[2],S[3],S[4],S[5],S[6],S[7],i+0);
+            RND(S[7],S[0],S[1],S[2],S[3],S[4],S[5],S[6],i+1);
+            RND(S[6],S[7],S[0],S[1],S[2],S[3],S[4],S[5],i+2);
+            RND(S[5],S[6],S[7],S[0],S[1],S[2],S[3],S[4],i+3);
+            RND(S[4],S[5],S[6],S[7],S[0],S[1],S[2],S[3],i+4);
+            RND(S[3],S[4],S[5],S[6],S[7],S[0],S[1],S[2],i+5);
+            RND(S[2],S[3],S[4],S[5],S[6],S[7],S[0],S[1],i+6);
+            RND(S[1],S[2],S[3],S[4],S[5],S[6],S[7],S[0],i+7);
+        }
 
-/* Compress */
-    #define RND(a,b,c,d,e,f,g,h,i) \
-    t0 = h + Sigma1(e) + Ch(e, f, g) + K[i] + W[i]; \
-    t1 = Sigma0(a) + Maj(a, b, c);\
-    d += t0; \
-    h  = t0 + t1;
+        #undef SCHEDULE
+        #undef RND
 
-    for (i = 0; i < 80; i += 8) {
-       RND(S[0],S[1],S[2],S[3],S[4],S[5],S[6],S[7],i+0);
-       RND(S[7],S[0],S[1],S[2],S[3],S[4],S[5],S[6],i+1);
-       RND(S[6],S[7],S[0],S[1],S[2],S[3],S[4],S[5],i+2);
-       RND(S[5],S[6],S[7],S[0],S[1],S[2],S[3],S[4],i+3);
-       RND(S[4],S[5],S[6],S[7],S[0],S[1],S[2],S[3],i+4);
-       RND(S[3],S[4],S[5],S[6],S[7],S[0],S[1],S[2],i+5);
-       RND(S[2],S[3],S[4],S[5],S[6],S[7],S[0],S[1],i+6);
-       RND(S[1],S[2],S[3],S[4],S[5],S[6],S[7],S[0],i+7);
-   }
+        for (i = 0; i < 8; i++) {
+            state[i] = state[i] + S[i];
+        }
+    }
+}
 
-   #undef RND
+#undef VROR64
+#undef VGamma0
+#undef VGamma1
+#endif
 
+typedef void (*sha512_blocks_fn)(uint64_t state[8], const unsigned char *buf, size_t blocks);
 
+static sha512_blocks_fn sha512_blocks_impl = NULL;
 
-    /* feedback */
-   for (i = 0; i < 8; i++) {
-        md->state[i] = md->state[i] + S[i];
+/* compress consecutive 128 byte blocks into the given state */
+void sha512_transform_blocks(uint64_t state[8], const unsigned char *buf, size_t blocks)
+{
+    if (sha512_blocks_impl == NULL) {
+        sha512_blocks_impl = sha512_blocks_ref;
+#ifdef NIMIQ_CPU_X86
+        if ((nimiq_cpu_features() & (NIMIQ_CPU_AVX2 | NIMIQ_CPU_BMI2)) == (NIMIQ_CPU_AVX2 | NIMIQ_CPU_BMI2)) {
+            sha512_blocks_impl = sha512_blocks_avx2;
+        }
+#endif
     }
+    sha512_blocks_impl(state, buf, blocks);
+}
 
+/* compress 1024-bits */
+static int sha512_compress(sha512_context *md, unsigned char *buf)
+{
+    sha512_transform_blocks(md->state, buf, 1);
     return 0;
 }
 
@@ -168,45 +281,43 @@ int sha512_init(sha512_context * md) {
    @param inlen  The length of the data (octets)
    @return 0 if successful
 */
-int sha512_update (sha512_context * md, const unsigned char *in, size_t inlen)               
-{                                                                                           
+int sha512_update (sha512_context * md, const unsigned char *in, size_t inlen)
+{
     size_t n;
-    size_t i;                                                                        
-    int           err;     
-    if (md == NULL) return 1;  
-    if (in == NULL) return 1;                                                              
-    if (md->curlen > sizeof(md->buf)) {                             
-       return 1;                                                            
-    }                                                                                       
-    while (inlen > 0) {                                                                     
-        if (md->curlen == 0 && inlen >= 128) {                           
-           if ((err = sha512_compress (md, (unsigned char *)in)) != 0) {               
-              return err;                                                                   
-           }                                                                                
-           md->length += 128 * 8;                                        
-           in             += 128;                                                    
-           inlen          -= 128;                                                    
-        } else {                                                                            
-           n = MIN(inlen, (128 - md->curlen));
-
-           for (i = 0; i < n; i++) {
-            md->buf[i + md->curlen] = in[i];
-           }
-
-
-           md->curlen += n;                                                     
-           in             += n;                                                             
-           inlen          -= n;                                                             
-           if (md->curlen == 128) {                                      
-              if ((err = sha512_compress (md, md->buf)) != 0) {            
-                 return err;                                                                
-              }                                                                             
-              md->length += 8*128;                                       
-              md->curlen = 0;                                                   
-           }                                                                                
-       }                                                                                    
-    }                                                                                       
-    return 0;                                                                        
+    if (md == NULL) return 1;
+    if (in == NULL) return 1;
+    if (md->curlen > sizeof(md->buf)) {
+       return 1;
+    }
+
+    /* top up a partially filled buffer first */
+    if (md->curlen > 0) {
+        n = MIN(inlen, (128 - md->curlen));
+        memcpy(md->buf + md->curlen, in, n);
+        md->curlen += n;
+        in         += n;
+        inlen      -= n;
+        if (md->curlen < 128) {
+            return 0;
+        }
+        sha512_compress(md, md->buf);
+        md->length += 8*128;
+        md->curlen = 0;
+    }
+
+    /* compress all full blocks straight from the input */
+    n = inlen / 128;
+    if (n > 0) {
+        sha512_transform_blocks(md->state, in, n);
+        md->length += n * 128 * 8;
+        in         += n * 128;
+        inlen      -= n * 128;
+    }
+
+    /* buffer the rest */
+    memcpy(md->buf, in, inlen);
+    md->curlen = inlen;
+    return 0;
 }
 
 /**
@@ -273,3 +384,183 @@ int sha512(const unsigned char *message, size_t message_len, unsigned char *out)
     if ((ret = sha512_final(&ctx, out))) return ret;
     return 0;
 }
+
+/* Multi-buffer hashing of many independent messages */
+
+#define SHA512_MAX_LANES 8
+
+typedef void (*sha512_lanes_fn)(uint64_t state[8][SHA512_MAX_LANES], const unsigned char *const blocks[]);
+
+static void sha512_serial(unsigned char *out, const unsigned char *in, const uint32_t *inlens, size_t count)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        sha512(in, inlens[i], out + 64*i);
+        in += inlens[i];
+    }
+}
+
+#ifdef NIMIQ_CPU_X86
+
+#define SHA512_LANES_NAME sha512_lanes_avx2
+#define SHA512_LANES_VEC sha512_vec4
+#define SHA512_LANES_N 4
+#define SHA512_LANES_TARGET "avx2"
+#include "sha512_lanes.h"
+#undef SHA512_LANES_NAME
+#undef SHA512_LANES_VEC
+#undef SHA512_LANES_N
+#undef SHA512_LANES_TARGET
+
+#define SHA512_LANES_NAME sha512_lanes_avx512
+#define SHA512_LANES_VEC sha512_vec8
+#define SHA512_LANES_N 8
+#define SHA512_LANES_TARGET "avx512f"
+#include "sha512_lanes.h"
+#undef SHA512_LANES_NAME
+#undef SHA512_LANES_VEC
+#undef SHA512_LANES_N
+#undef SHA512_LANES_TARGET
+
+/* one message being hashed in a lane of the multi-buffer kernels */
+typedef struct sha512_lane_ {
+    const unsigned char *data;      /* next full block of the message */
+    size_t blocks;                  /* full blocks left in the message */
+    unsigned char tail[256];        /* remaining bytes followed by the padding */
+    const unsigned char *tail_next; /* next block in tail */
+    size_t tail_blocks;             /* padded blocks left in tail */
+    unsigned char *out;
+} sha512_lane;
+
+static void sha512_lane_init(sha512_lane *lane, const unsigned char *data, size_t len, unsigned char *out)
+{
+    size_t rem = len % 128;
+
+    lane->data = data;
+    lane->blocks = len / 128;
+    lane->tail_next = lane->tail;
+    lane->tail_blocks = rem < 112 ? 1 : 2;
+    lane->out = out;
+    memset(lane->tail, 0, sizeof(lane->tail));
+    memcpy(lane->tail, data + len - rem, rem);
+    lane->tail[rem] = 0x80;
+    STORE64H((uint64_t)len * 8, lane->tail + 128*lane->tail_blocks - 8);
+}
+
+/* next block of the lane's padded message, NULL once it is done */
+static const unsigned char *sha512_lane_next(sha512_lane *lane)
+{
+    const unsigned char *block = NULL;
+
+    if (lane->blocks > 0) {
+        block = lane->data;
+        lane->data += 128;
+        lane->blocks--;
+    } else if (lane->tail_blocks > 0) {
+        block = lane->tail_next;
+        lane->tail_next += 128;
+        lane->tail_blocks--;
+    }
+    return block;
+}
+
+static void sha512_lane_finish(sha512_lane *lane, uint64_t state[8][SHA512_MAX_LANES], int j)
+{
+    sha512_context md;
+    const unsigned char *block;
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        md.state[i] = state[i][j];
+    }
+    while ((block = sha512_lane_next(lane)) != NULL) {
+        sha512_compress(&md, (unsigned char *)block);
+    }
+    for (i = 0; i < 8; i++) {
+        STORE64H(md.state[i], lane->out + (8*i));
+    }
+}
+
+/*
+ * Hashes count messages with a multi-buffer kernel of the given width.
+ * A lane picks up the next message as soon as its current one is done.
+ * Once the queue is empty and less than half of the lanes are busy, the
+ * remaining messages are finished one by one.
+ */
+static void sha512_multi_lanes(sha512_lanes_fn lanes_fn, int width, unsigned char *out, const unsigned char *in, const uint32_t *inlens, size_t count)
+{
+    static const unsigned char idle[128] = {0};
+    uint64_t state[8][SHA512_MAX_LANES];
+    sha512_lane lane[SHA512_MAX_LANES];
+    const unsigned char *blocks[SHA512_MAX_LANES];
+    int active[SHA512_MAX_LANES];
+    sha512_context iv;
+    size_t next = 0;
+    int busy = 0, i, j;
+
+    sha512_init(&iv);
+    for (j = 0; j < width; j++) {
+        active[j] = 0;
+    }
+
+    for (;;) {
+        for (j = 0; j < width && next < count; j++) {
+            if (active[j]) continue;
+            sha512_lane_init(&lane[j], in, inlens[next], out + 64*next);
+            in += inlens[next];
+            next++;
+            for (i = 0; i < 8; i++) {
+                state[i][j] = iv.state[i];
+            }
+            active[j] = 1;
+            busy++;
+        }
+
+        if (next == count && 2 * busy < width) break;
+
+        for (j = 0; j < width; j++) {
+            blocks[j] = active[j] ? sha512_lane_next(&lane[j]) : idle;
+        }
+        lanes_fn(state, blocks);
+
+        for (j = 0; j < width; j++) {
+            if (active[j] && lane[j].blocks == 0 && lane[j].tail_blocks == 0) {
+                sha512_lane_finish(&lane[j], state, j);
+                active[j] = 0;
+                busy--;
+            }
+        }
+    }
+
+    for (j = 0; j < width; j++) {
+        if (active[j]) {
+            sha512_lane_finish(&lane[j], state, j);
+        }
+    }
+}
+
+#endif
+
+/**
+   Hash many independent messages
+   @param out     [out] count 64 byte digests
+   @param in      The messages, stored back to back
+   @param inlens  The length of each message (octets)
+   @param count   The number of messages
+*/
+void sha512_multi(unsigned char *out, const unsigned char *in, const uint32_t *inlens, size_t count)
+{
+#ifdef NIMIQ_CPU_X86
+    int features = nimiq_cpu_features();
+
+    if ((features & NIMIQ_CPU_AVX512F) && count >= 4) {
+        sha512_multi_lanes(sha512_lanes_avx512, 8, out, in, inlens, count);
+        return;
+    }
+    if ((features & NIMIQ_CPU_AVX2) && count >= 2) {
+        sha512_multi_lanes(sha512_lanes_avx2, 4, out, in, inlens, count);
+        return;
+    }
+#endif
+    sha512_serial(out, in, inlens, count);
+}
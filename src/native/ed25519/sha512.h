@@ -16,6 +16,8 @@ typedef struct sha512_context_ {
 int sha512_init(sha512_context * md);
 int sha512_final(sha512_context * md, unsigned char *out);
 int sha512_update(sha512_context * md, const unsigned char *in, size_t inlen);
+void sha512_transform_blocks(uint64_t state[8], const unsigned char *buf, size_t blocks);
 int sha512(const unsigned char *message, size_t message_len, unsigned char *out);
+void sha512_multi(unsigned char *out, const unsigned char *in, const uint32_t *inlens, size_t count);
 
 #endif
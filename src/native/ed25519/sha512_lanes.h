@@ -0,0 +1,56 @@
+/*
+ * Multi-buffer SHA-512 compression, included by sha512.c once per vector width.
+ * Needs SHA512_LANES_NAME, SHA512_LANES_VEC, SHA512_LANES_N and SHA512_LANES_TARGET.
+ *
+ * Compresses one 128 byte block into each of SHA512_LANES_N independent states,
+ * one state per vector lane. state[i][j] holds word i of lane j.
+ */
+
+typedef uint64_t SHA512_LANES_VEC __attribute__((vector_size(8 * SHA512_LANES_N)));
+
+__attribute__((target(SHA512_LANES_TARGET)))
+static void SHA512_LANES_NAME(uint64_t state[8][SHA512_MAX_LANES], const unsigned char *const blocks[])
+{
+    SHA512_LANES_VEC S[8], W[16], t0, t1;
+    uint64_t words[SHA512_LANES_N];
+    int i, j;
+
+    for (i = 0; i < 16; i++) {
+        for (j = 0; j < SHA512_LANES_N; j++) {
+            LOAD64H(words[j], blocks[j] + (8*i));
+        }
+        memcpy(&W[i], words, sizeof(W[i]));
+    }
+    for (i = 0; i < 8; i++) {
+        memcpy(&S[i], state[i], sizeof(S[i]));
+    }
+
+    #define RND(a,b,c,d,e,f,g,h,i) \
+    if ((i) >= 16) W[(i) & 15] = Gamma1(W[((i) - 2) & 15]) + W[((i) - 7) & 15] + Gamma0(W[((i) - 15) & 15]) + W[(i) & 15]; \
+    t0 = h + Sigma1(e) + Ch(e, f, g) + K[i] + W[(i) & 15]; \
+    t1 = Sigma0(a) + Maj(a, b, c);\
+    d += t0; \
+    h  = t0 + t1;
+
+    {
+        SHA512_LANES_VEC A = S[0], B = S[1], C = S[2], D = S[3], E = S[4], F = S[5], G = S[6], H = S[7];
+        for (i = 0; i < 80; i += 8) {
+            RND(A,B,C,D,E,F,G,H,i+0);
+            RND(H,A,B,C,D,E,F,G,i+1);
+            RND(G,H,A,B,C,D,E,F,i+2);
+            RND(F,G,H,A,B,C,D,E,i+3);
+            RND(E,F,G,H,A,B,C,D,i+4);
+            RND(D,E,F,G,H,A,B,C,i+5);
+            RND(C,D,E,F,G,H,A,B,i+6);
+            RND(B,C,D,E,F,G,H,A,i+7);
+        }
+        S[0] += A; S[1] += B; S[2] += C; S[3] += D;
+        S[4] += E; S[5] += F; S[6] += G; S[7] += H;
+    }
+
+    #undef RND
+
+    for (i = 0; i < 8; i++) {
+        memcpy(state[i], &S[i], sizeof(S[i]));
+    }
+}
@@ -0,0 +1,86 @@
+#include <string.h>
+
+#include "lock.h"
+#include "sig_cache.h"
+
+typedef struct {
+    unsigned char digest[32];
+    unsigned char s[32];
+    uint64_t last_used; /* 0 if the slot is empty */
+} sig_cache_slot;
+
+static sig_cache_slot cache[SIG_CACHE_SETS][SIG_CACHE_WAYS];
+static ed25519_lock_t cache_lock = ED25519_LOCK_INIT;
+static uint64_t cache_clock = 0;
+static uint64_t cache_hits = 0;
+static uint64_t cache_misses = 0;
+
+/* The digest is a hash output already, so its first bytes select the set. */
+static size_t sig_cache_set(const unsigned char *digest) {
+    uint32_t x = (uint32_t) digest[0] | ((uint32_t) digest[1] << 8) | ((uint32_t) digest[2] << 16) | ((uint32_t) digest[3] << 24);
+    return (size_t) x % SIG_CACHE_SETS;
+}
+
+static sig_cache_slot *sig_cache_find(sig_cache_slot *set, const unsigned char *digest, const unsigned char *s) {
+    size_t i;
+
+    for (i = 0; i < SIG_CACHE_WAYS; ++i) {
+        if (set[i].last_used && memcmp(set[i].digest, digest, 32) == 0 && memcmp(set[i].s, s, 32) == 0) {
+            return &set[i];
+        }
+    }
+    return NULL;
+}
+
+/* Returns 1 if the signature identified by digest and s is cached, 0 otherwise. */
+int sig_cache_contains(const unsigned char *digest, const unsigned char *s) {
+    sig_cache_slot *slot;
+
+    ed25519_lock(&cache_lock);
+    slot = sig_cache_find(cache[sig_cache_set(digest)], digest, s);
+    if (slot) {
+        slot->last_used = ++cache_clock;
+        cache_hits++;
+    } else {
+        cache_misses++;
+    }
+    ed25519_unlock(&cache_lock);
+    return slot != NULL;
+}
+
+/* Inserts a verified signature, replacing the least recently used one of its set. */
+void sig_cache_insert(const unsigned char *digest, const unsigned char *s) {
+    sig_cache_slot *set = cache[sig_cache_set(digest)];
+    sig_cache_slot *victim;
+    size_t i;
+
+    ed25519_lock(&cache_lock);
+    victim = sig_cache_find(set, digest, s);
+    if (!victim) {
+        victim = &set[0];
+        for (i = 1; i < SIG_CACHE_WAYS; ++i) {
+            if (set[i].last_used < victim->last_used) {
+                victim = &set[i];
+            }
+        }
+        memcpy(victim->digest, digest, 32);
+        memcpy(victim->s, s, 32);
+    }
+    victim->last_used = ++cache_clock;
+    ed25519_unlock(&cache_lock);
+}
+
+void sig_cache_stats(uint64_t *hits, uint64_t *misses) {
+    ed25519_lock(&cache_lock);
+    *hits = cache_hits;
+    *misses = cache_misses;
+    ed25519_unlock(&cache_lock);
+}
+
+void sig_cache_clear(void) {
+    ed25519_lock(&cache_lock);
+    memset(cache, 0, sizeof(cache));
+    cache_hits = 0;
+    cache_misses = 0;
+    ed25519_unlock(&cache_lock);
+}
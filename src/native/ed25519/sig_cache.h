@@ -0,0 +1,22 @@
+#ifndef SIG_CACHE_H
+#define SIG_CACHE_H
+
+#include "fixedint.h"
+
+/*
+Bounded cache of verified signatures, shared by all threads. A signature
+(R, s) of message M by public key A is identified by s and the first 32
+bytes of SHA-512(R || A || M), which the verifier computes anyway, so a
+lookup costs no extra hashing. Only signatures that passed the exact check
+of ed25519_verify are inserted.
+*/
+
+#define SIG_CACHE_SETS 1024
+#define SIG_CACHE_WAYS 8 /* SIG_CACHE_SETS * SIG_CACHE_WAYS signatures, 72 bytes each */
+
+int sig_cache_contains(const unsigned char *digest, const unsigned char *s);
+void sig_cache_insert(const unsigned char *digest, const unsigned char *s);
+void sig_cache_stats(uint64_t *hits, uint64_t *misses);
+void sig_cache_clear(void);
+
+#endif
@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include "ed25519.h"
 #include "sha512.h"
 #include "ge.h"
@@ -47,6 +49,14 @@ void ed25519_delinearized_partial_sign(unsigned char *partial_signature, const u
     create_signature(partial_signature, message, message_len, commitment_R, secret_r, delinearized_public_key, delinearized_private_key);
 }
 
+/*
+ * Partially signs M with the aggregate public key and the delinearized
+ * private key of a multisig context set up with a private key.
+ */
+void ed25519_multisig_partial_sign(unsigned char *partial_signature, const unsigned char *message, size_t message_len, const unsigned char* commitment_R, const unsigned char *secret_r, const ed25519_multisig_context *context) {
+    create_signature(partial_signature, message, message_len, commitment_R, secret_r, context->aggregate_public_key, context->delinearized_private_key);
+}
+
 void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *private_key) {
     sha512_context hash;
     unsigned char az[64];
@@ -67,3 +77,66 @@ void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t
 
     create_signature(signature + 32, message, message_len, signature, r, public_key, az);
 }
+
+void ed25519_expand_key(ed25519_expanded_key *key, const unsigned char *private_key) {
+    ge_p3 A;
+
+    ed25519_private_key_decompress(key->az, private_key);
+
+    sha512_init(&key->prefix);
+    sha512_update(&key->prefix, key->az + 32, 32);
+
+    ge_scalarmult_base(&A, key->az);
+    ge_p3_tobytes(key->public_key, &A);
+}
+
+/*
+ * r = H(prefix || M) mod l, the nonce of the signature of M.
+ */
+static void expanded_key_nonce(unsigned char *r, const unsigned char *message, size_t message_len, const ed25519_expanded_key *key) {
+    sha512_context hash = key->prefix;
+
+    sha512_update(&hash, message, message_len);
+    sha512_final(&hash, r);
+    sc_reduce(r);
+}
+
+void ed25519_sign_expanded(unsigned char *signature, const unsigned char *message, size_t message_len, const ed25519_expanded_key *key) {
+    unsigned char r[64];
+    ge_p3 R;
+
+    expanded_key_nonce(r, message, message_len, key);
+    ge_scalarmult_base(&R, r);
+    ge_p3_tobytes(signature, &R);
+
+    create_signature(signature + 32, message, message_len, signature, r, key->public_key, key->az);
+}
+
+/*
+ * Signs n messages, stored back to back as for ed25519_verify_batch, with the
+ * same key. The commitments R of up to GE_BATCH_SIZE signatures are encoded
+ * together with a single field inversion.
+ */
+void ed25519_sign_many(unsigned char *signatures, const unsigned char *messages, const uint32_t *message_lens, size_t n, const ed25519_expanded_key *key) {
+    unsigned char r[GE_BATCH_SIZE][64];
+    unsigned char R[32 * GE_BATCH_SIZE];
+    ge_p3 points[GE_BATCH_SIZE];
+    const unsigned char *message;
+    size_t chunk;
+    size_t i;
+
+    for ( ; n > 0; n -= chunk, message_lens += chunk, signatures += 64 * chunk) {
+        chunk = n < GE_BATCH_SIZE ? n : GE_BATCH_SIZE;
+
+        for (i = 0, message = messages; i < chunk; message += message_lens[i++]) {
+            expanded_key_nonce(r[i], message, message_lens[i], key);
+            ge_scalarmult_base(&points[i], r[i]);
+        }
+        ge_p3_batch_tobytes(R, points, chunk);
+
+        for (i = 0; i < chunk; messages += message_lens[i++]) {
+            memcpy(signatures + 64 * i, R + 32 * i, 32);
+            create_signature(signatures + 64 * i + 32, messages, message_lens[i], R + 32 * i, r[i], key->public_key, key->az);
+        }
+    }
+}
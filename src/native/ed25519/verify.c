@@ -1,7 +1,11 @@
+#include <string.h>
+
 #include "ed25519.h"
 #include "sha512.h"
 #include "ge.h"
 #include "sc.h"
+#include "key_cache.h"
+#include "sig_cache.h"
 
 static int consttime_equal(const unsigned char *x, const unsigned char *y) {
     unsigned char r = 0;
@@ -44,12 +48,39 @@ static int consttime_equal(const unsigned char *x, const unsigned char *y) {
     return !r;
 }
 
-int ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
-    unsigned char h[64];
+/* Checks [s]B = R + [h]A with the odd multiples Ai of the negated point A precomputed. */
+static int check_equation(const unsigned char *R, const unsigned char *s, const unsigned char *h, const ge_cached *Ai) {
     unsigned char checker[32];
+    ge_p2 check;
+
+    ge_double_scalarmult_vartime_cached(&check, h, Ai, s);
+    ge_tobytes(checker, &check);
+
+    if (!consttime_equal(checker, R)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+/* Checks the signature with the negated public key point decoded and its odd multiples Ai precomputed. */
+static int verify_decoded(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const ge_cached *Ai) {
+    unsigned char h[64];
     sha512_context hash;
+
+    sha512_init(&hash);
+    sha512_update(&hash, signature, 32);
+    sha512_update(&hash, public_key, 32);
+    sha512_update(&hash, message, message_len);
+    sha512_final(&hash, h);
+    
+    sc_reduce(h);
+    return check_equation(signature, signature + 32, h, Ai);
+}
+
+int ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    ge_cached Ai[8];
     ge_p3 A;
-    ge_p2 R;
 
     if (signature[63] & 224) {
         return 0;
@@ -59,19 +90,381 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
         return 0;
     }
 
+    ge_p3_odd_multiples(Ai, &A);
+    return verify_decoded(signature, message, message_len, public_key, Ai);
+}
+
+/*
+ * Same as ed25519_verify, but takes the decoded public key from the key cache
+ * and skips signatures found in the signature cache. Valid signatures are
+ * added to the signature cache.
+ */
+
+int ed25519_verify_cached(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    unsigned char h[64];
+    unsigned char digest[32];
+    key_cache_entry key;
+    sha512_context hash;
+
+    if (signature[63] & 224) {
+        return 0;
+    }
+
     sha512_init(&hash);
     sha512_update(&hash, signature, 32);
     sha512_update(&hash, public_key, 32);
     sha512_update(&hash, message, message_len);
     sha512_final(&hash, h);
-    
-    sc_reduce(h);
-    ge_double_scalarmult_vartime(&R, h, &A, signature + 32);
-    ge_tobytes(checker, &R);
 
-    if (!consttime_equal(checker, signature)) {
+    memcpy(digest, h, 32);
+    if (sig_cache_contains(digest, signature + 32)) {
+        return 1;
+    }
+
+    if (key_cache_get(&key, public_key) != 0) {
         return 0;
     }
 
+    sc_reduce(h);
+    if (!check_equation(signature, signature + 32, h, key.Ai)) {
+        return 0;
+    }
+
+    sig_cache_insert(digest, signature + 32);
     return 1;
 }
+
+/*
+ * Checks n signatures one by one with ed25519_verify_cached. Messages are stored back
+ * to back as for ed25519_verify_batch. Stores 1 (valid) or 0 (invalid) for each
+ * signature to valid and returns 1 if all signatures are valid.
+ */
+
+int ed25519_verify_many(unsigned char *valid, const unsigned char *signatures, const unsigned char *messages, const uint32_t *message_lens, const unsigned char *public_keys, size_t n) {
+    int all_valid = 1;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        valid[i] = (unsigned char) ed25519_verify_cached(signatures + 64 * i, messages, message_lens[i], public_keys + 32 * i);
+        messages += message_lens[i];
+        all_valid &= valid[i];
+    }
+
+    return all_valid;
+}
+
+/*
+ * Checks the equations [s_i]B = R_i + [h_i]A_i for count equations, at most
+ * ED25519_VERIFY_BATCH_SIZE, with a random linear combination (see
+ * ed25519_verify_batch). tables[2 * i] must hold the odd multiples of -A_i,
+ * the remaining tables are overwritten. If the combination does not hold,
+ * the equations are checked one by one. Stores 1 (valid) or 0 (invalid) for
+ * each equation to valid.
+ *
+ * seed holds 32 bytes of randomness followed by room for the 8 byte counter,
+ * which is advanced for every four equations.
+ */
+static void verify_equations(unsigned char *valid, const unsigned char **R, const unsigned char **s, const unsigned char (*h)[32], ge_cached (*tables)[8], size_t count, unsigned char *seed, uint64_t *counter) {
+    unsigned char scalars[2 * ED25519_VERIFY_BATCH_SIZE + 1][32];
+    unsigned char randomizers[ED25519_VERIFY_BATCH_SIZE][32];
+    unsigned char gathered_h[ED25519_VERIFY_BATCH_SIZE][32];
+    unsigned char gathered_s[ED25519_VERIFY_BATCH_SIZE][32];
+    unsigned char encoded[ED25519_VERIFY_BATCH_SIZE][32];
+    unsigned char z[64];
+    size_t indices[ED25519_VERIFY_BATCH_SIZE];
+    ge_p3 negative_points[ED25519_VERIFY_BATCH_SIZE];
+    ge_p3 points[ED25519_VERIFY_BATCH_SIZE];
+    ge_p3 S;
+    ge_p2 check;
+    fe t;
+    size_t n = 0;
+    size_t i;
+    size_t j;
+
+    /* Decode -R. Equations that fail here also fail check_equation. */
+    for (i = 0; i < count; ++i) {
+        valid[i] = 0;
+        if (ge_frombytes_negate_vartime(&negative_points[n], R[i]) != 0) continue;
+
+        if (n != i) {
+            memcpy(tables[2 * n], tables[2 * i], sizeof(tables[0]));
+        }
+        fe_neg(points[n].X, negative_points[n].X);
+        fe_copy(points[n].Y, negative_points[n].Y);
+        fe_copy(points[n].Z, negative_points[n].Z);
+        fe_neg(points[n].T, negative_points[n].T);
+        indices[n++] = i;
+    }
+
+    if (n == 0) {
+        return;
+    }
+
+    /* check_equation compares against the encoding of R, so it has to be canonical. */
+    ge_p3_batch_tobytes(encoded[0], points, n);
+    for (i = 0, j = 0; i < n; ++i) {
+        if (!consttime_equal(encoded[i], R[indices[i]])) continue;
+        if (j != i) {
+            memcpy(tables[2 * j], tables[2 * i], sizeof(tables[0]));
+        }
+        ge_p3_odd_multiples(tables[2 * j + 1], &negative_points[i]);
+        indices[j++] = indices[i];
+    }
+    n = j;
+
+    if (n == 0) {
+        return;
+    }
+
+    /* Scalars z_i h_i for -A_i, z_i for -R_i and sum z_i s_i for B. */
+    for (i = 0; i < n; ++i) {
+        if (i % 4 == 0) {
+            for (j = 0; j < 8; ++j) {
+                seed[32 + j] = (unsigned char) (*counter >> (8 * j));
+            }
+            (*counter)++;
+            sha512(seed, 40, z);
+        }
+        for (j = 0; j < 16; ++j) {
+            randomizers[i][j] = z[16 * (i % 4) + j];
+            randomizers[i][16 + j] = 0;
+        }
+        memcpy(gathered_h[i], h[indices[i]], 32);
+        memcpy(gathered_s[i], s[indices[i]], 32);
+    }
+    sc_mul_many(gathered_h, (const unsigned char (*)[32]) randomizers, (const unsigned char (*)[32]) gathered_h, n);
+    sc_inner_product(scalars[2 * n], (const unsigned char (*)[32]) randomizers, (const unsigned char (*)[32]) gathered_s, n);
+    for (i = 0; i < n; ++i) {
+        memcpy(scalars[2 * i], gathered_h[i], 32);
+        memcpy(scalars[2 * i + 1], randomizers[i], 32);
+    }
+
+    ge_scalarmult_base(&S, scalars[2 * n]);
+    ge_p3_odd_multiples(tables[2 * n], &S);
+    scalars[2 * n][0] = 1;
+    for (i = 1; i < 32; ++i) {
+        scalars[2 * n][i] = 0;
+    }
+    ge_multi_scalarmult_vartime(&check, scalars[0], (const ge_cached (*)[8]) tables, 2 * n + 1);
+    fe_sub(t, check.Y, check.Z);
+
+    if (!fe_isnonzero(check.X) && !fe_isnonzero(t)) {
+        for (i = 0; i < n; ++i) {
+            valid[indices[i]] = 1;
+        }
+    } else {
+        /* At least one equation does not hold, find out which. */
+        for (i = 0; i < n; ++i) {
+            j = indices[i];
+            valid[j] = (unsigned char) check_equation(R[j], s[j], h[j], tables[2 * i]);
+        }
+    }
+}
+
+/*
+ * Checks the equation [s]B = R + [h]A of each signature in chunks of
+ * ED25519_VERIFY_BATCH_SIZE: with random 128 bit z_i, a chunk is valid if
+ *   [sum z_i s_i]B - sum [z_i]R_i - sum [z_i h_i]A_i = 0,
+ * which takes a single multi-scalar multiplication. If a chunk fails, its
+ * signatures are checked one by one to find the invalid ones. Signatures in
+ * the signature cache are not checked again, but only ed25519_verify_cached
+ * adds signatures to it, as the random combination is not an exact check.
+ *
+ * Messages are stored back to back, message i is message_lens[i] bytes long.
+ * randomness must be 32 bytes of cryptographically secure random data.
+ * Stores 1 (valid) or 0 (invalid) for each signature to valid and returns 1
+ * if all signatures are valid.
+ *
+ * The random combination is only checked up to the prime order part, like in
+ * every batch verifier: a signature whose R or public key was crafted with a
+ * small order component fails ed25519_verify, but can pass a batch with a
+ * probability of up to 1/2. Use ed25519_verify where that matters.
+ */
+
+int ed25519_verify_batch(unsigned char *valid, const unsigned char *signatures, const unsigned char *messages, const uint32_t *message_lens, const unsigned char *public_keys, size_t n, const unsigned char *randomness) {
+    const unsigned char *R[ED25519_VERIFY_BATCH_SIZE];
+    const unsigned char *s[ED25519_VERIFY_BATCH_SIZE];
+    unsigned char h[ED25519_VERIFY_BATCH_SIZE][32];
+    unsigned char checked[ED25519_VERIFY_BATCH_SIZE];
+    unsigned char seed[40];
+    unsigned char hram[64];
+    size_t indices[ED25519_VERIFY_BATCH_SIZE];
+    ge_cached tables[2 * ED25519_VERIFY_BATCH_SIZE + 1][8];
+    key_cache_entry key;
+    sha512_context hash;
+    uint64_t counter = 0;
+    size_t chunk;
+    size_t count;
+    size_t i;
+    int all_valid = 1;
+
+    for (i = 0; i < 32; ++i) {
+        seed[i] = randomness[i];
+    }
+
+    for ( ; n > 0; n -= chunk) {
+        chunk = n < ED25519_VERIFY_BATCH_SIZE ? n : ED25519_VERIFY_BATCH_SIZE;
+        count = 0;
+
+        if (chunk == 1) {
+            /* Nothing to combine, the random linear combination would only add work. */
+            valid[0] = (unsigned char) ed25519_verify_cached(signatures, messages, message_lens[0], public_keys);
+            return all_valid & valid[0];
+        }
+
+        /*
+         * Compute h = H(R || A || M) and decode -A through the key cache. Signatures in
+         * the signature cache are valid already.
+         */
+        for (i = 0; i < chunk; ++i) {
+            const unsigned char *signature = signatures + 64 * i;
+            const unsigned char *message = messages;
+            messages += message_lens[i];
+            valid[i] = 0;
+
+            if (signature[63] & 224) continue;
+
+            sha512_init(&hash);
+            sha512_update(&hash, signature, 32);
+            sha512_update(&hash, public_keys + 32 * i, 32);
+            sha512_update(&hash, message, message_lens[i]);
+            sha512_final(&hash, hram);
+
+            if (sig_cache_contains(hram, signature + 32)) {
+                valid[i] = 1;
+                continue;
+            }
+            if (key_cache_get(&key, public_keys + 32 * i) != 0) continue;
+
+            memcpy(tables[2 * count], key.Ai, sizeof(key.Ai));
+            sc_reduce(hram);
+            memcpy(h[count], hram, 32);
+
+            R[count] = signature;
+            s[count] = signature + 32;
+            indices[count++] = i;
+        }
+
+        verify_equations(checked, R, s, (const unsigned char (*)[32]) h, tables, count, seed, &counter);
+        for (i = 0; i < count; ++i) {
+            valid[indices[i]] = checked[i];
+        }
+
+        for (i = 0; i < chunk; ++i) {
+            all_valid &= valid[i];
+        }
+        valid += chunk;
+        signatures += 64 * chunk;
+        public_keys += 32 * chunk;
+        message_lens += chunk;
+    }
+
+    return all_valid;
+}
+
+/*
+ * c = H(R || P || M) mod l for the aggregate commitment R and the aggregate
+ * public key P of a multisig context, as in create_signature.
+ */
+static void multisig_challenge(unsigned char *c, const unsigned char *message, size_t message_len, const unsigned char *aggregate_commitment, const ed25519_multisig_context *context) {
+    unsigned char hram[64];
+    sha512_context hash;
+
+    sha512_init(&hash);
+    sha512_update(&hash, aggregate_commitment, 32);
+    sha512_update(&hash, context->aggregate_public_key, 32);
+    sha512_update(&hash, message, message_len);
+    sha512_final(&hash, hram);
+    sc_reduce(hram);
+    memcpy(c, hram, 32);
+}
+
+/*
+ * Checks the partial signature s_i of cosigner i (in the order of the
+ * multisig context) for its commitment R_i and the aggregate commitment R:
+ *   [s_i]B = R_i + [c H(C || P_i)]P_i, where c = H(R || P || M).
+ * Returns 1 if it is valid.
+ */
+
+int ed25519_multisig_verify_partial(const unsigned char *partial_signature, const unsigned char *commitment_R, const unsigned char *message, size_t message_len, const unsigned char *aggregate_commitment, size_t cosigner, const ed25519_multisig_context *context) {
+    const unsigned char zero[32] = {0};
+    unsigned char c[32];
+    unsigned char h[32];
+    key_cache_entry key;
+
+    if (cosigner >= context->num_cosigners || (partial_signature[31] & 224)) {
+        return 0;
+    }
+
+    if (key_cache_get(&key, context->cosigners[cosigner].public_key) != 0) {
+        return 0;
+    }
+
+    multisig_challenge(c, message, message_len, aggregate_commitment, context);
+    sc_muladd(h, c, context->cosigners[cosigner].delinearization_scalar, zero);
+    return check_equation(commitment_R, partial_signature, h, key.Ai);
+}
+
+/*
+ * Checks the partial signatures of all cosigners of a multisig context like
+ * ed25519_multisig_verify_partial, combined as in ed25519_verify_batch.
+ * partial_signatures and commitments hold 32 bytes for each cosigner in the
+ * order of the context. randomness must be 32 bytes of cryptographically
+ * secure random data. Stores 1 (valid) or 0 (invalid) for each cosigner to
+ * valid and returns 1 if all partial signatures are valid.
+ */
+
+int ed25519_multisig_verify_partials(unsigned char *valid, const unsigned char *partial_signatures, const unsigned char *commitments, const unsigned char *message, size_t message_len, const unsigned char *aggregate_commitment, const ed25519_multisig_context *context, const unsigned char *randomness) {
+    const unsigned char zero[32] = {0};
+    const unsigned char *R[ED25519_VERIFY_BATCH_SIZE];
+    const unsigned char *s[ED25519_VERIFY_BATCH_SIZE];
+    unsigned char h[ED25519_VERIFY_BATCH_SIZE][32];
+    unsigned char checked[ED25519_VERIFY_BATCH_SIZE];
+    unsigned char seed[40];
+    unsigned char c[32];
+    size_t indices[ED25519_VERIFY_BATCH_SIZE];
+    ge_cached tables[2 * ED25519_VERIFY_BATCH_SIZE + 1][8];
+    key_cache_entry key;
+    uint64_t counter = 0;
+    size_t n = context->num_cosigners;
+    size_t chunk;
+    size_t count;
+    size_t start;
+    size_t i;
+    int all_valid = 1;
+
+    for (i = 0; i < 32; ++i) {
+        seed[i] = randomness[i];
+    }
+
+    multisig_challenge(c, message, message_len, aggregate_commitment, context);
+
+    for (start = 0; start < n; start += chunk) {
+        chunk = n - start < ED25519_VERIFY_BATCH_SIZE ? n - start : ED25519_VERIFY_BATCH_SIZE;
+        count = 0;
+
+        for (i = start; i < start + chunk; ++i) {
+            valid[i] = 0;
+
+            if (partial_signatures[32 * i + 31] & 224) continue;
+            if (key_cache_get(&key, context->cosigners[i].public_key) != 0) continue;
+
+            memcpy(tables[2 * count], key.Ai, sizeof(key.Ai));
+            sc_muladd(h[count], c, context->cosigners[i].delinearization_scalar, zero);
+            R[count] = commitments + 32 * i;
+            s[count] = partial_signatures + 32 * i;
+            indices[count++] = i;
+        }
+
+        verify_equations(checked, R, s, (const unsigned char (*)[32]) h, tables, count, seed, &counter);
+        for (i = 0; i < count; ++i) {
+            valid[indices[i]] = checked[i];
+        }
+
+        for (i = start; i < start + chunk; ++i) {
+            all_valid &= valid[i];
+        }
+    }
+
+    return all_valid;
+}
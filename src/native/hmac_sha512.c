@@ -0,0 +1,41 @@
+#include <string.h>
+
+#include "hmac_sha512.h"
+
+void hmac_sha512_init(hmac_sha512_context *ctx, const unsigned char *key, size_t keylen) {
+    unsigned char pad[HMAC_SHA512_BLOCK_SIZE];
+    unsigned char hashed_key[HMAC_SHA512_SIZE];
+    size_t i;
+
+    /* keys longer than a block are replaced by their hash */
+    if (keylen > HMAC_SHA512_BLOCK_SIZE) {
+        sha512(key, keylen, hashed_key);
+        key = hashed_key;
+        keylen = HMAC_SHA512_SIZE;
+    }
+
+    memset(pad, 0x36, sizeof(pad));
+    for (i = 0; i < keylen; ++i) pad[i] ^= key[i];
+    sha512_init(&ctx->inner);
+    sha512_update(&ctx->inner, pad, sizeof(pad));
+
+    memset(pad, 0x5c, sizeof(pad));
+    for (i = 0; i < keylen; ++i) pad[i] ^= key[i];
+    sha512_init(&ctx->outer);
+    sha512_update(&ctx->outer, pad, sizeof(pad));
+}
+
+/* Finishes a MAC from the inner digest SHA512((key ^ ipad) || message). */
+void hmac_sha512_digest(const hmac_sha512_context *ctx, const unsigned char *inner_digest, unsigned char *out) {
+    sha512_context md = ctx->outer;
+    sha512_update(&md, inner_digest, HMAC_SHA512_SIZE);
+    sha512_final(&md, out);
+}
+
+void hmac_sha512(const hmac_sha512_context *ctx, const unsigned char *in, size_t inlen, unsigned char *out) {
+    unsigned char inner_digest[HMAC_SHA512_SIZE];
+    sha512_context md = ctx->inner;
+    sha512_update(&md, in, inlen);
+    sha512_final(&md, inner_digest);
+    hmac_sha512_digest(ctx, inner_digest, out);
+}
@@ -0,0 +1,25 @@
+#ifndef __NIMIQ_HMAC_SHA512_H
+#define __NIMIQ_HMAC_SHA512_H
+
+#include <stddef.h>
+
+#include "ed25519/sha512.h"
+
+#define HMAC_SHA512_BLOCK_SIZE 128
+#define HMAC_SHA512_SIZE 64
+
+/*
+ * HMAC-SHA512 keyed with a fixed key. The hash states after absorbing the
+ * inner and outer padded key are computed once, so each MAC only costs the
+ * compressions of the message and of the inner digest.
+ */
+typedef struct hmac_sha512_context_ {
+    sha512_context inner;
+    sha512_context outer;
+} hmac_sha512_context;
+
+void hmac_sha512_init(hmac_sha512_context *ctx, const unsigned char *key, size_t keylen);
+void hmac_sha512(const hmac_sha512_context *ctx, const unsigned char *in, size_t inlen, unsigned char *out);
+void hmac_sha512_digest(const hmac_sha512_context *ctx, const unsigned char *inner_digest, unsigned char *out);
+
+#endif
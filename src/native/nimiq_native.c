@@ -3,11 +3,23 @@
 #include <stdio.h>
 #if defined(_WIN32)
     #include <winsock2.h>
+    #include <bcrypt.h>
     #pragma comment(lib, "Ws2_32.lib")
+    #pragma comment(lib, "bcrypt.lib")
 #else
     #include <arpa/inet.h>
 #endif
+#if defined(__linux__)
+    #include <errno.h>
+    #include <sys/random.h>
+#elif defined(__APPLE__)
+    #include <sys/types.h>
+    #include <sys/random.h>
+#elif !defined(_WIN32)
+    #include <unistd.h>
+#endif
 #include "nimiq_native.h"
+#include "ed25519/ed25519.h"
 
 static inline uint16_t bswap_16(uint16_t x) {
   return (x>>8) | (x<<8);
@@ -92,6 +104,24 @@ void nimiq_sha512(void *out, const void *in, const size_t inlen) {
     sha512_final(&ctx, out);
 }
 
+void nimiq_sha256_batch(void *out, const void *in, const uint32_t *inlens, const size_t count) {
+    sha256_multi(out, in, inlens, count);
+}
+
+void nimiq_sha512_batch(void *out, const void *in, const uint32_t *inlens, const size_t count) {
+    sha512_multi(out, in, inlens, count);
+}
+
+void nimiq_hmac_sha512(void *out, const void *key, const size_t keylen, const void *in, const size_t inlen) {
+    hmac_sha512_context ctx;
+    hmac_sha512_init(&ctx, key, keylen);
+    hmac_sha512(&ctx, in, inlen, out);
+}
+
+void nimiq_pbkdf2_sha512(void *out, const size_t outlen, const void *password, const size_t passlen, const void *salt, const size_t saltlen, const uint32_t iterations) {
+    pbkdf2_sha512(out, outlen, password, passlen, salt, saltlen, iterations);
+}
+
 inline int nimiq_argon2_flags(void *out, const void *in, const size_t inlen, const uint32_t m_cost, const uint32_t flags) {
     return argon2d_hash_raw_flags(1, m_cost == 0 ? NIMIQ_DEFAULT_ARGON2_COST : m_cost, 1, in, inlen, NIMIQ_ARGON2_SALT, NIMIQ_ARGON2_SALT_LEN, out, 32, flags);
 }
@@ -136,6 +166,66 @@ uint32_t nimiq_argon2_target(void *out, void *in, const size_t inlen, const uint
     return ntohl(noncer[0]);
 }
 
+size_t nimiq_hash_size(const uint32_t algorithm) {
+    switch (algorithm) {
+        case NIMIQ_HASH_BLAKE2B:
+        case NIMIQ_HASH_ARGON2D:
+        case NIMIQ_HASH_SHA256:
+            return 32;
+        case NIMIQ_HASH_SHA512:
+            return 64;
+        default:
+            return 0;
+    }
+}
+
+/*
+ * Computes hash^depth(in), i.e. hashes a digest of the given algorithm depth times.
+ * Both in and out are nimiq_hash_size(algorithm) bytes long and may overlap.
+ * Returns ARGON2_OK (0) on success.
+ */
+int nimiq_hash_chain(void *out, const void *in, const uint32_t algorithm, const uint32_t depth) {
+    uint8_t buf[2][NIMIQ_HASH_MAX_SIZE];
+    size_t size = nimiq_hash_size(algorithm);
+    uint32_t i;
+    int ret;
+    if (size == 0) return NIMIQ_HASH_INVALID_ALGORITHM;
+
+    memcpy(buf[0], in, size);
+    for (i = 0; i < depth; ++i) {
+        const uint8_t* src = buf[i & 1];
+        uint8_t* dst = buf[(i + 1) & 1];
+        switch (algorithm) {
+            case NIMIQ_HASH_BLAKE2B:
+                ret = nimiq_blake2(dst, src, size);
+                if (ret != ARGON2_OK) return ret;
+                break;
+            case NIMIQ_HASH_ARGON2D:
+                ret = nimiq_argon2(dst, src, size, NIMIQ_DEFAULT_ARGON2_COST);
+                if (ret != ARGON2_OK) return ret;
+                break;
+            case NIMIQ_HASH_SHA256:
+                nimiq_sha256(dst, src, size);
+                break;
+            case NIMIQ_HASH_SHA512:
+                nimiq_sha512(dst, src, size);
+                break;
+        }
+    }
+    memcpy(out, buf[depth & 1], size);
+    return ARGON2_OK;
+}
+
+/*
+ * Checks whether hash^depth(in) equals root. Returns 0 if it does.
+ */
+int nimiq_hash_chain_verify(const void *root, const void *in, const uint32_t algorithm, const uint32_t depth) {
+    uint8_t out[NIMIQ_HASH_MAX_SIZE];
+    int ret = nimiq_hash_chain(out, in, algorithm, depth);
+    if (ret != ARGON2_OK) return ret;
+    return memcmp(root, out, nimiq_hash_size(algorithm));
+}
+
 int nimiq_argon2_verify(const void *hash, const void *in, const size_t inlen, const uint32_t m_cost) {
     void* out = malloc(32);
     nimiq_argon2(out, in, inlen, m_cost);
@@ -144,3 +234,137 @@ int nimiq_argon2_verify(const void *hash, const void *in, const size_t inlen, co
     return res;
 }
 
+#define NIMIQ_DERIVE_BATCH 64
+
+/*
+ * Derives the public keys and/or addresses of count private keys. Either of
+ * public_keys and addresses may be NULL. The keys are derived with
+ * ed25519_public_keys_derive, which shares the field inversion of a batch.
+ */
+void nimiq_public_keys_derive(void *public_keys, void *addresses, const void *private_keys, const size_t count) {
+    uint8_t keys[NIMIQ_DERIVE_BATCH * NIMIQ_PUBLIC_KEY_SIZE];
+    uint8_t hash[32];
+    size_t chunk;
+
+    for(size_t start = 0; start < count; start += chunk) {
+        chunk = count - start < NIMIQ_DERIVE_BATCH ? count - start : NIMIQ_DERIVE_BATCH;
+        uint8_t* out = public_keys ? (uint8_t*) public_keys + start * NIMIQ_PUBLIC_KEY_SIZE : keys;
+        ed25519_public_keys_derive(out, (const uint8_t*) private_keys + start * NIMIQ_PUBLIC_KEY_SIZE, chunk);
+
+        if (addresses) {
+            for(size_t i = 0; i < chunk; ++i) {
+                nimiq_blake2(hash, out + i * NIMIQ_PUBLIC_KEY_SIZE, NIMIQ_PUBLIC_KEY_SIZE);
+                memcpy((uint8_t*) addresses + (start + i) * NIMIQ_ADDRESS_SIZE, hash, NIMIQ_ADDRESS_SIZE);
+            }
+        }
+    }
+}
+
+/*
+ * Fills out with outlen bytes from the cryptographically secure random number
+ * generator of the operating system. Returns 0 on success and -1 on failure.
+ */
+int nimiq_random(void *out, const size_t outlen) {
+    uint8_t* buf = out;
+    size_t done = 0;
+#if defined(_WIN32)
+    while (done < outlen) {
+        ULONG chunk = outlen - done > 0x10000000 ? 0x10000000 : (ULONG) (outlen - done);
+        if (BCryptGenRandom(NULL, buf + done, chunk, BCRYPT_USE_SYSTEM_PREFERRED_RNG) != 0) return -1;
+        done += chunk;
+    }
+#elif defined(__linux__)
+    while (done < outlen) {
+        ssize_t ret = getrandom(buf + done, outlen - done, 0);
+        if (ret < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        done += (size_t) ret;
+    }
+#else
+    /* getentropy returns at most 256 bytes per call */
+    while (done < outlen) {
+        size_t chunk = outlen - done > 256 ? 256 : outlen - done;
+        if (getentropy(buf + done, chunk) != 0) return -1;
+        done += chunk;
+    }
+#endif
+    return 0;
+}
+
+/*
+ * Generates count key pairs: fills private_keys with count * NIMIQ_PRIVATE_KEY_SIZE
+ * bytes from nimiq_random and derives the public keys and/or addresses with
+ * nimiq_public_keys_derive. Either of public_keys and addresses may be NULL.
+ * Returns 0 on success and -1 if the operating system provided no randomness,
+ * in which case private_keys is zeroed and nothing is derived.
+ */
+int nimiq_key_pairs_generate(void *private_keys, void *public_keys, void *addresses, const size_t count) {
+    if (nimiq_random(private_keys, count * NIMIQ_PRIVATE_KEY_SIZE) != 0) {
+        memset(private_keys, 0, count * NIMIQ_PRIVATE_KEY_SIZE);
+        return -1;
+    }
+    if (public_keys || addresses) {
+        nimiq_public_keys_derive(public_keys, addresses, private_keys, count);
+    }
+    return 0;
+}
+
+/*
+ * Verifies a serialized SignatureProof, i.e. a public key, a Merkle path and a
+ * signature: the root of the Merkle path, starting from the Blake2b hash of the
+ * public key, must hash to the sender address, unless sender is NULL, and the
+ * signature of message must be valid for the public key. The proof has to be
+ * exactly proof_len bytes long. Returns one of the NIMIQ_SIGNATURE_PROOF_*
+ * results, NIMIQ_SIGNATURE_PROOF_VALID (0) if the proof is valid.
+ */
+int nimiq_signature_proof_verify(const void *proof, const size_t proof_len, const void *sender, const void *message, const size_t message_len) {
+    const uint8_t* in = proof;
+    const uint8_t* left_bits;
+    const uint8_t* nodes;
+    uint8_t concat[64];
+    uint8_t root[32];
+    size_t count, left_bits_size;
+
+    if (proof_len < NIMIQ_PUBLIC_KEY_SIZE + 1) return NIMIQ_SIGNATURE_PROOF_MALFORMED;
+    count = in[NIMIQ_PUBLIC_KEY_SIZE];
+    left_bits_size = (count + 7) / 8;
+    if (proof_len != NIMIQ_PUBLIC_KEY_SIZE + 1 + left_bits_size + count * 32 + NIMIQ_SIGNATURE_SIZE) return NIMIQ_SIGNATURE_PROOF_MALFORMED;
+    left_bits = in + NIMIQ_PUBLIC_KEY_SIZE + 1;
+    nodes = left_bits + left_bits_size;
+
+    if (sender) {
+        nimiq_blake2(root, in, NIMIQ_PUBLIC_KEY_SIZE);
+        for(size_t i = 0; i < count; ++i) {
+            int left = (left_bits[i / 8] & (0x80 >> (i % 8))) != 0;
+            memcpy(concat + (left ? 0 : 32), nodes + i * 32, 32);
+            memcpy(concat + (left ? 32 : 0), root, 32);
+            nimiq_blake2(root, concat, 64);
+        }
+        if (memcmp(root, sender, NIMIQ_ADDRESS_SIZE) != 0) return NIMIQ_SIGNATURE_PROOF_WRONG_SIGNER;
+    }
+
+    if (!ed25519_verify_cached(nodes + count * 32, message, message_len, in)) return NIMIQ_SIGNATURE_PROOF_INVALID_SIGNATURE;
+    return NIMIQ_SIGNATURE_PROOF_VALID;
+}
+
+/*
+ * Verifies count serialized SignatureProofs with nimiq_signature_proof_verify
+ * and stores the results to results. Proofs and messages are stored back to
+ * back, senders are NIMIQ_ADDRESS_SIZE bytes each, or NULL to skip the signer
+ * checks. Returns 1 if all proofs are valid.
+ */
+int nimiq_signature_proofs_verify(uint8_t *results, const void *proofs, const uint32_t *proof_lens, const void *senders, const void *messages, const uint32_t *message_lens, const size_t count) {
+    const uint8_t* proof = proofs;
+    const uint8_t* message = messages;
+    int all_valid = 1;
+
+    for(size_t i = 0; i < count; ++i) {
+        results[i] = (uint8_t) nimiq_signature_proof_verify(proof, proof_lens[i], senders ? (const uint8_t*) senders + i * NIMIQ_ADDRESS_SIZE : NULL, message, message_lens[i]);
+        all_valid &= results[i] == NIMIQ_SIGNATURE_PROOF_VALID;
+        proof += proof_lens[i];
+        message += message_lens[i];
+    }
+    return all_valid;
+}
@@ -5,11 +5,32 @@
 #include "blake2/blake2.h"
 #include "sha256.h"
 #include "ed25519/sha512.h"
+#include "hmac_sha512.h"
+#include "pbkdf2_sha512.h"
 
 #define NIMIQ_ARGON2_SALT "nimiqrocks!"
 #define NIMIQ_ARGON2_SALT_LEN 11
 #define NIMIQ_DEFAULT_ARGON2_COST 512
 
+/* Hash algorithm identifiers, matching Hash.Algorithm on the JavaScript side */
+#define NIMIQ_HASH_BLAKE2B 1
+#define NIMIQ_HASH_ARGON2D 2
+#define NIMIQ_HASH_SHA256 3
+#define NIMIQ_HASH_SHA512 4
+#define NIMIQ_HASH_MAX_SIZE 64
+#define NIMIQ_HASH_INVALID_ALGORITHM -1
+
+#define NIMIQ_PRIVATE_KEY_SIZE 32
+#define NIMIQ_PUBLIC_KEY_SIZE 32
+#define NIMIQ_ADDRESS_SIZE 20 /* the first 20 bytes of the Blake2b hash of the public key */
+#define NIMIQ_SIGNATURE_SIZE 64
+
+/* Results of nimiq_signature_proof_verify */
+#define NIMIQ_SIGNATURE_PROOF_VALID 0
+#define NIMIQ_SIGNATURE_PROOF_MALFORMED 1
+#define NIMIQ_SIGNATURE_PROOF_WRONG_SIGNER 2
+#define NIMIQ_SIGNATURE_PROOF_INVALID_SIGNATURE 3
+
 int nimiq_blake2(void *out, const void *in, const size_t inlen);
 int nimiq_argon2(void *out, const void *in, const size_t inlen, const uint32_t m_cost);
 int nimiq_kdf_legacy(void *out, const size_t outlen, const void *in, const size_t inlen, const void* seed, const size_t seedlen, const uint32_t m_cost, const uint32_t iter);
@@ -18,5 +39,17 @@ uint32_t nimiq_argon2_target(void *out, void *in, const size_t inlen, const uint
 int nimiq_argon2_verify(const void *hash, const void *in, const size_t inlen, const uint32_t m_cost);
 void nimiq_sha256(void *out, const void *in, const size_t inlen);
 void nimiq_sha512(void *out, const void *in, const size_t inlen);
+void nimiq_sha256_batch(void *out, const void *in, const uint32_t *inlens, const size_t count);
+void nimiq_sha512_batch(void *out, const void *in, const uint32_t *inlens, const size_t count);
+void nimiq_hmac_sha512(void *out, const void *key, const size_t keylen, const void *in, const size_t inlen);
+void nimiq_pbkdf2_sha512(void *out, const size_t outlen, const void *password, const size_t passlen, const void *salt, const size_t saltlen, const uint32_t iterations);
+size_t nimiq_hash_size(const uint32_t algorithm);
+int nimiq_hash_chain(void *out, const void *in, const uint32_t algorithm, const uint32_t depth);
+int nimiq_hash_chain_verify(const void *root, const void *in, const uint32_t algorithm, const uint32_t depth);
+void nimiq_public_keys_derive(void *public_keys, void *addresses, const void *private_keys, const size_t count);
+int nimiq_random(void *out, const size_t outlen);
+int nimiq_key_pairs_generate(void *private_keys, void *public_keys, void *addresses, const size_t count);
+int nimiq_signature_proof_verify(const void *proof, const size_t proof_len, const void *sender, const void *message, const size_t message_len);
+int nimiq_signature_proofs_verify(uint8_t *results, const void *proofs, const uint32_t *proof_lens, const void *senders, const void *messages, const uint32_t *message_lens, const size_t count);
 
 #endif
@@ -2,6 +2,10 @@
 extern "C" {
 #include "nimiq_native.h"
 #include "ed25519/ed25519.h"
+#include "ed25519/key_cache.h"
+#include "ed25519/sig_cache.h"
+#include "slip10.h"
+#include "vanity.h"
 }
 
 using v8::Function;
@@ -11,6 +15,7 @@ using v8::Number;
 using v8::Object;
 using v8::String;
 using v8::Uint8Array;
+using v8::Uint32Array;
 using v8::Value;
 using Nan::AsyncQueueWorker;
 using Nan::AsyncWorker;
@@ -73,6 +78,250 @@ class Argon2Worker : public AsyncWorker {
         int res;
 };
 
+class HashChainWorker : public AsyncWorker {
+    public:
+        HashChainWorker(Callback* callback, void* out, void* in, uint32_t algorithm, uint32_t depth)
+            : AsyncWorker(callback), out(out), in(in), algorithm(algorithm), depth(depth), res(0) {}
+        ~HashChainWorker() {}
+
+        void Execute() {
+            res = nimiq_hash_chain(out, in, algorithm, depth);
+        }
+
+        void HandleOKCallback() {
+            HandleScope scope;
+            Local<Value> argv[] = {New<Number>(res)};
+            callback->Call(1, argv, async_resource);
+        }
+
+    private:
+        void* out;
+        void* in;
+        uint32_t algorithm;
+        uint32_t depth;
+        int res;
+};
+
+class Pbkdf2Worker : public AsyncWorker {
+    public:
+        Pbkdf2Worker(Callback* callback, void* out, uint32_t outlen, void* password, uint32_t passlen, void* salt, uint32_t saltlen, uint32_t iterations)
+            : AsyncWorker(callback), out(out), outlen(outlen), password(password), passlen(passlen), salt(salt), saltlen(saltlen), iterations(iterations) {}
+        ~Pbkdf2Worker() {}
+
+        void Execute() {
+            nimiq_pbkdf2_sha512(out, outlen, password, passlen, salt, saltlen, iterations);
+        }
+
+        void HandleOKCallback() {
+            HandleScope scope;
+            Local<Value> argv[] = {New<Number>(0)};
+            callback->Call(1, argv, async_resource);
+        }
+
+    private:
+        void* out;
+        uint32_t outlen;
+        void* password;
+        uint32_t passlen;
+        void* salt;
+        uint32_t saltlen;
+        uint32_t iterations;
+};
+
+class Slip10RangeWorker : public AsyncWorker {
+    public:
+        Slip10RangeWorker(Callback* callback, uint8_t* private_keys, uint8_t* public_keys, uint8_t* addresses, uint8_t* parent, uint32_t* path, uint32_t depth, uint32_t variable_level, uint32_t first_index, uint32_t count)
+            : AsyncWorker(callback), private_keys(private_keys), public_keys(public_keys), addresses(addresses), parent(parent), path(path), depth(depth), variable_level(variable_level), first_index(first_index), count(count) {}
+        ~Slip10RangeWorker() {}
+
+        void Execute() {
+            slip10_derive_range(private_keys, public_keys, addresses, parent, path, depth, variable_level, first_index, count);
+        }
+
+        void HandleOKCallback() {
+            HandleScope scope;
+            Local<Value> argv[] = {New<Number>(0)};
+            callback->Call(1, argv, async_resource);
+        }
+
+    private:
+        uint8_t* private_keys;
+        uint8_t* public_keys;
+        uint8_t* addresses;
+        uint8_t* parent;
+        uint32_t* path;
+        uint32_t depth;
+        uint32_t variable_level;
+        uint32_t first_index;
+        uint32_t count;
+};
+
+class PublicKeysDeriveWorker : public AsyncWorker {
+    public:
+        PublicKeysDeriveWorker(Callback* callback, uint8_t* public_keys, uint8_t* addresses, uint8_t* private_keys, uint32_t count)
+            : AsyncWorker(callback), public_keys(public_keys), addresses(addresses), private_keys(private_keys), count(count) {}
+        ~PublicKeysDeriveWorker() {}
+
+        void Execute() {
+            nimiq_public_keys_derive(public_keys, addresses, private_keys, count);
+        }
+
+        void HandleOKCallback() {
+            HandleScope scope;
+            Local<Value> argv[] = {New<Number>(0)};
+            callback->Call(1, argv, async_resource);
+        }
+
+    private:
+        uint8_t* public_keys;
+        uint8_t* addresses;
+        uint8_t* private_keys;
+        uint32_t count;
+};
+
+class KeyPairsGenerateWorker : public AsyncWorker {
+    public:
+        KeyPairsGenerateWorker(Callback* callback, uint8_t* private_keys, uint8_t* public_keys, uint8_t* addresses, uint32_t count)
+            : AsyncWorker(callback), private_keys(private_keys), public_keys(public_keys), addresses(addresses), count(count), res(0) {}
+        ~KeyPairsGenerateWorker() {}
+
+        void Execute() {
+            res = nimiq_key_pairs_generate(private_keys, public_keys, addresses, count);
+        }
+
+        void HandleOKCallback() {
+            HandleScope scope;
+            Local<Value> argv[] = {New<Number>(res)};
+            callback->Call(1, argv, async_resource);
+        }
+
+    private:
+        uint8_t* private_keys;
+        uint8_t* public_keys;
+        uint8_t* addresses;
+        uint32_t count;
+        int res;
+};
+
+class VerifyManyWorker : public AsyncWorker {
+    public:
+        VerifyManyWorker(Callback* callback, uint8_t* valid, uint8_t* signatures, uint8_t* messages, uint32_t* lens, uint8_t* pubkeys, uint32_t count)
+            : AsyncWorker(callback), valid(valid), signatures(signatures), messages(messages), lens(lens), pubkeys(pubkeys), count(count), res(0) {}
+        ~VerifyManyWorker() {}
+
+        void Execute() {
+            res = ed25519_verify_many(valid, signatures, messages, lens, pubkeys, count);
+        }
+
+        void HandleOKCallback() {
+            HandleScope scope;
+            Local<Value> argv[] = {New<Number>(res)};
+            callback->Call(1, argv, async_resource);
+        }
+
+    private:
+        uint8_t* valid;
+        uint8_t* signatures;
+        uint8_t* messages;
+        uint32_t* lens;
+        uint8_t* pubkeys;
+        uint32_t count;
+        int res;
+};
+
+class SignatureProofsVerifyWorker : public AsyncWorker {
+    public:
+        SignatureProofsVerifyWorker(Callback* callback, uint8_t* results, uint8_t* proofs, uint32_t* proof_lens, uint8_t* senders, uint8_t* messages, uint32_t* message_lens, uint32_t count)
+            : AsyncWorker(callback), results(results), proofs(proofs), proof_lens(proof_lens), senders(senders), messages(messages), message_lens(message_lens), count(count), res(0) {}
+        ~SignatureProofsVerifyWorker() {}
+
+        void Execute() {
+            res = nimiq_signature_proofs_verify(results, proofs, proof_lens, senders, messages, message_lens, count);
+        }
+
+        void HandleOKCallback() {
+            HandleScope scope;
+            Local<Value> argv[] = {New<Number>(res)};
+            callback->Call(1, argv, async_resource);
+        }
+
+    private:
+        uint8_t* results;
+        uint8_t* proofs;
+        uint32_t* proof_lens;
+        uint8_t* senders;
+        uint8_t* messages;
+        uint32_t* message_lens;
+        uint32_t count;
+        int res;
+};
+
+class SignManyWorker : public AsyncWorker {
+    public:
+        SignManyWorker(Callback* callback, uint8_t* signatures, uint8_t* messages, uint32_t* lens, uint32_t count, const ed25519_expanded_key* key)
+            : AsyncWorker(callback), signatures(signatures), messages(messages), lens(lens), count(count), key(*key) {}
+        ~SignManyWorker() {}
+
+        void Execute() {
+            ed25519_sign_many(signatures, messages, lens, count, &key);
+        }
+
+    private:
+        uint8_t* signatures;
+        uint8_t* messages;
+        uint32_t* lens;
+        uint32_t count;
+        ed25519_expanded_key key;
+};
+
+class VanityWorker : public AsyncWorker {
+    public:
+        VanityWorker(Callback* callback, uint8_t* matches, uint32_t max_matches, uint8_t* key, uint32_t first_candidate, uint32_t candidates, uint8_t* pattern, uint32_t pattern_len, uint32_t mode)
+            : AsyncWorker(callback), matches(matches), max_matches(max_matches), key(key), first_candidate(first_candidate), candidates(candidates), pattern(pattern), pattern_len(pattern_len), mode(mode), found(0) {}
+        ~VanityWorker() {}
+
+        void Execute() {
+            found = vanity_search(matches, max_matches, key, first_candidate, candidates, pattern, pattern_len, mode);
+        }
+
+        void HandleOKCallback() {
+            HandleScope scope;
+            Local<Value> argv[] = {New<Number>(found)};
+            callback->Call(1, argv, async_resource);
+        }
+
+    private:
+        uint8_t* matches;
+        uint32_t max_matches;
+        uint8_t* key;
+        uint32_t first_candidate;
+        uint32_t candidates;
+        uint8_t* pattern;
+        uint32_t pattern_len;
+        uint32_t mode;
+        size_t found;
+};
+
+// Returns the data of a typed array, which may be a view at an offset into its ArrayBuffer.
+static void* buffer_data(Local<v8::TypedArray> array) {
+#if (V8_MAJOR_VERSION >= 10 && V8_MINOR_VERSION >= 1)
+    return (uint8_t*) array->Buffer()->GetBackingStore()->Data() + array->ByteOffset();
+#else
+    return (uint8_t*) array->Buffer()->GetContents().Data() + array->ByteOffset();
+#endif
+}
+
+// Sets data to the data of an optional output buffer, or NULL if it is not given.
+// Returns false if the buffer is given but too small.
+static bool optional_buffer_data(Local<Value> value, size_t length, uint8_t** data) {
+    *data = NULL;
+    if (!value->IsUint8Array()) return true;
+    Local<Uint8Array> array = value.As<Uint8Array>();
+    if (array->Length() < length) return false;
+    *data = (uint8_t*) buffer_data(array);
+    return true;
+}
+
 NAN_METHOD(node_argon2_target_async) {
     Callback* callback = new Callback(info[0].As<Function>());
 
@@ -121,6 +370,213 @@ NAN_METHOD(node_sha512) {
     nimiq_sha512(out, in, inlen);
 }
 
+NAN_METHOD(node_sha256_batch) {
+    Local<Uint8Array> out_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> in_array = info[1].As<Uint8Array>();
+    Local<Uint32Array> inlens_array = info[2].As<Uint32Array>();
+    size_t count = inlens_array->Length();
+    void* out = buffer_data(out_array);
+    void* in = buffer_data(in_array);
+    uint32_t* inlens = (uint32_t*) buffer_data(inlens_array);
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; i++) total += inlens[i];
+    if (out_array->Length() != count * 32 || total > in_array->Length()) {
+        Nan::ThrowRangeError("Invalid batch size");
+        return;
+    }
+    nimiq_sha256_batch(out, in, inlens, count);
+}
+
+NAN_METHOD(node_sha512_batch) {
+    Local<Uint8Array> out_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> in_array = info[1].As<Uint8Array>();
+    Local<Uint32Array> inlens_array = info[2].As<Uint32Array>();
+    size_t count = inlens_array->Length();
+    void* out = buffer_data(out_array);
+    void* in = buffer_data(in_array);
+    uint32_t* inlens = (uint32_t*) buffer_data(inlens_array);
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; i++) total += inlens[i];
+    if (out_array->Length() != count * 64 || total > in_array->Length()) {
+        Nan::ThrowRangeError("Invalid batch size");
+        return;
+    }
+    nimiq_sha512_batch(out, in, inlens, count);
+}
+
+NAN_METHOD(node_hmac_sha512_init) {
+    Local<Uint8Array> ctx_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> key_array = info[1].As<Uint8Array>();
+    uint32_t keylen = key_array->Length();
+    if (ctx_array->Length() != sizeof(hmac_sha512_context)) {
+        Nan::ThrowRangeError("Invalid HMAC context size");
+        return;
+    }
+    void* ctx_data = buffer_data(ctx_array);
+    unsigned char* key = (unsigned char*) buffer_data(key_array);
+    // The context lives in a JS buffer without alignment guarantees, so it is copied in and out.
+    hmac_sha512_context ctx;
+    hmac_sha512_init(&ctx, key, keylen);
+    memcpy(ctx_data, &ctx, sizeof(ctx));
+}
+
+NAN_METHOD(node_hmac_sha512) {
+    Local<Uint8Array> out_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> ctx_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> in_array = info[2].As<Uint8Array>();
+    uint32_t inlen = in_array->Length();
+    if (out_array->Length() != HMAC_SHA512_SIZE || ctx_array->Length() != sizeof(hmac_sha512_context)) {
+        Nan::ThrowRangeError("Invalid HMAC output or context size");
+        return;
+    }
+    unsigned char* out = (unsigned char*) buffer_data(out_array);
+    void* ctx_data = buffer_data(ctx_array);
+    unsigned char* in = (unsigned char*) buffer_data(in_array);
+    hmac_sha512_context ctx;
+    memcpy(&ctx, ctx_data, sizeof(ctx));
+    hmac_sha512(&ctx, in, inlen, out);
+}
+
+NAN_METHOD(node_pbkdf2_sha512) {
+    Local<Uint8Array> out_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> password_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> salt_array = info[2].As<Uint8Array>();
+    uint32_t iterations = To<uint32_t>(info[3]).FromJust();
+    uint32_t outlen = out_array->Length();
+    uint32_t passlen = password_array->Length();
+    uint32_t saltlen = salt_array->Length();
+    void* out = buffer_data(out_array);
+    void* password = buffer_data(password_array);
+    void* salt = buffer_data(salt_array);
+    nimiq_pbkdf2_sha512(out, outlen, password, passlen, salt, saltlen, iterations);
+}
+
+NAN_METHOD(node_pbkdf2_sha512_async) {
+    Callback* callback = new Callback(info[0].As<Function>());
+
+    Local<Uint8Array> out_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> password_array = info[2].As<Uint8Array>();
+    Local<Uint8Array> salt_array = info[3].As<Uint8Array>();
+    uint32_t iterations = To<uint32_t>(info[4]).FromJust();
+    uint32_t outlen = out_array->Length();
+    uint32_t passlen = password_array->Length();
+    uint32_t saltlen = salt_array->Length();
+    void* out = buffer_data(out_array);
+    void* password = buffer_data(password_array);
+    void* salt = buffer_data(salt_array);
+
+    Pbkdf2Worker* worker = new Pbkdf2Worker(callback, out, outlen, password, passlen, salt, saltlen, iterations);
+    worker->SaveToPersistent("out", out_array);
+    worker->SaveToPersistent("password", password_array);
+    worker->SaveToPersistent("salt", salt_array);
+    AsyncQueueWorker(worker);
+}
+
+NAN_METHOD(node_slip10_master_key) {
+    Local<Uint8Array> out_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> seed_array = info[1].As<Uint8Array>();
+    uint32_t seedlen = seed_array->Length();
+    if (out_array->Length() != SLIP10_EXTENDED_KEY_SIZE) {
+        Nan::ThrowRangeError("Invalid extended key size");
+        return;
+    }
+    uint8_t* out = (uint8_t*) buffer_data(out_array);
+    uint8_t* seed = (uint8_t*) buffer_data(seed_array);
+    slip10_master_key(out, seed, seedlen);
+}
+
+// Arguments from offset on: private keys, public keys, addresses (each optional), parent, path, variable level, first index, count
+static bool slip10_range_arguments(const Nan::FunctionCallbackInfo<Value>& info, int offset, uint8_t** private_keys, uint8_t** public_keys, uint8_t** addresses,
+        uint8_t** parent, uint32_t** path, uint32_t* depth, uint32_t* variable_level, uint32_t* first_index, uint32_t* count) {
+    Local<Uint8Array> parent_array = info[offset + 3].As<Uint8Array>();
+    Local<Uint32Array> path_array = info[offset + 4].As<Uint32Array>();
+    *depth = path_array->Length();
+    *variable_level = To<uint32_t>(info[offset + 5]).FromJust();
+    *first_index = To<uint32_t>(info[offset + 6]).FromJust();
+    *count = To<uint32_t>(info[offset + 7]).FromJust();
+    if (parent_array->Length() != SLIP10_EXTENDED_KEY_SIZE || *variable_level >= *depth) return false;
+
+    if (!optional_buffer_data(info[offset], (size_t) *count * SLIP10_PRIVATE_KEY_SIZE, private_keys)
+            || !optional_buffer_data(info[offset + 1], (size_t) *count * SLIP10_PUBLIC_KEY_SIZE, public_keys)
+            || !optional_buffer_data(info[offset + 2], (size_t) *count * SLIP10_ADDRESS_SIZE, addresses)) return false;
+    *parent = (uint8_t*) buffer_data(parent_array);
+    *path = (uint32_t*) buffer_data(path_array);
+    return true;
+}
+
+NAN_METHOD(node_slip10_derive_range) {
+    uint8_t *private_keys, *public_keys, *addresses, *parent;
+    uint32_t *path, depth, variable_level, first_index, count;
+    if (!slip10_range_arguments(info, 0, &private_keys, &public_keys, &addresses, &parent, &path, &depth, &variable_level, &first_index, &count)) {
+        Nan::ThrowRangeError("Invalid derivation arguments");
+        return;
+    }
+    slip10_derive_range(private_keys, public_keys, addresses, parent, path, depth, variable_level, first_index, count);
+}
+
+NAN_METHOD(node_slip10_derive_range_async) {
+    uint8_t *private_keys, *public_keys, *addresses, *parent;
+    uint32_t *path, depth, variable_level, first_index, count;
+    if (!slip10_range_arguments(info, 1, &private_keys, &public_keys, &addresses, &parent, &path, &depth, &variable_level, &first_index, &count)) {
+        Nan::ThrowRangeError("Invalid derivation arguments");
+        return;
+    }
+
+    Callback* callback = new Callback(info[0].As<Function>());
+    Slip10RangeWorker* worker = new Slip10RangeWorker(callback, private_keys, public_keys, addresses, parent, path, depth, variable_level, first_index, count);
+    if (private_keys) worker->SaveToPersistent("private_keys", info[1]);
+    if (public_keys) worker->SaveToPersistent("public_keys", info[2]);
+    if (addresses) worker->SaveToPersistent("addresses", info[3]);
+    worker->SaveToPersistent("parent", info[4]);
+    worker->SaveToPersistent("path", info[5]);
+    AsyncQueueWorker(worker);
+}
+
+NAN_METHOD(node_vanity_search) {
+    Local<Uint8Array> matches_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> key_array = info[1].As<Uint8Array>();
+    uint32_t first_candidate = To<uint32_t>(info[2]).FromJust();
+    uint32_t candidates = To<uint32_t>(info[3]).FromJust();
+    Local<Uint8Array> pattern_array = info[4].As<Uint8Array>();
+    uint32_t mode = To<uint32_t>(info[5]).FromJust();
+    uint32_t max_matches = matches_array->Length() / VANITY_SEED_SIZE;
+    uint32_t pattern_len = pattern_array->Length();
+    if (key_array->Length() != VANITY_KEY_SIZE || pattern_len > VANITY_ADDRESS_CHARS) {
+        Nan::ThrowRangeError("Invalid key or pattern size");
+        return;
+    }
+    uint8_t* matches = (uint8_t*) buffer_data(matches_array);
+    uint8_t* key = (uint8_t*) buffer_data(key_array);
+    uint8_t* pattern = (uint8_t*) buffer_data(pattern_array);
+    size_t found = vanity_search(matches, max_matches, key, first_candidate, candidates, pattern, pattern_len, mode);
+    info.GetReturnValue().Set(New<Number>(found));
+}
+
+NAN_METHOD(node_vanity_search_async) {
+    Local<Uint8Array> matches_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> key_array = info[2].As<Uint8Array>();
+    uint32_t first_candidate = To<uint32_t>(info[3]).FromJust();
+    uint32_t candidates = To<uint32_t>(info[4]).FromJust();
+    Local<Uint8Array> pattern_array = info[5].As<Uint8Array>();
+    uint32_t mode = To<uint32_t>(info[6]).FromJust();
+    uint32_t max_matches = matches_array->Length() / VANITY_SEED_SIZE;
+    uint32_t pattern_len = pattern_array->Length();
+    if (key_array->Length() != VANITY_KEY_SIZE || pattern_len > VANITY_ADDRESS_CHARS) {
+        Nan::ThrowRangeError("Invalid key or pattern size");
+        return;
+    }
+    uint8_t* matches = (uint8_t*) buffer_data(matches_array);
+    uint8_t* key = (uint8_t*) buffer_data(key_array);
+    uint8_t* pattern = (uint8_t*) buffer_data(pattern_array);
+
+    Callback* callback = new Callback(info[0].As<Function>());
+    VanityWorker* worker = new VanityWorker(callback, matches, max_matches, key, first_candidate, candidates, pattern, pattern_len, mode);
+    worker->SaveToPersistent("matches", matches_array);
+    worker->SaveToPersistent("key", key_array);
+    worker->SaveToPersistent("pattern", pattern_array);
+    AsyncQueueWorker(worker);
+}
+
 NAN_METHOD(node_blake2) {
     Local<Uint8Array> out_array = info[0].As<Uint8Array>();
     Local<Uint8Array> in_array = info[1].As<Uint8Array>();
@@ -168,6 +624,58 @@ NAN_METHOD(node_argon2_async) {
     AsyncQueueWorker(new Argon2Worker(callback, out, in, inlen, m_cost));
 }
 
+NAN_METHOD(node_hash_chain) {
+    Local<Uint8Array> out_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> in_array = info[1].As<Uint8Array>();
+    uint32_t algorithm = To<uint32_t>(info[2]).FromJust();
+    uint32_t depth = To<uint32_t>(info[3]).FromJust();
+    if (nimiq_hash_size(algorithm) == 0 || out_array->Length() != nimiq_hash_size(algorithm) || in_array->Length() != nimiq_hash_size(algorithm)) {
+        info.GetReturnValue().Set(New<Number>(NIMIQ_HASH_INVALID_ALGORITHM));
+        return;
+    }
+    void* out = buffer_data(out_array);
+    void* in = buffer_data(in_array);
+
+    info.GetReturnValue().Set(New<Number>(nimiq_hash_chain(out, in, algorithm, depth)));
+}
+
+NAN_METHOD(node_hash_chain_async) {
+    Callback* callback = new Callback(info[0].As<Function>());
+
+    Local<Uint8Array> out_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> in_array = info[2].As<Uint8Array>();
+    uint32_t algorithm = To<uint32_t>(info[3]).FromJust();
+    uint32_t depth = To<uint32_t>(info[4]).FromJust();
+    if (nimiq_hash_size(algorithm) == 0 || out_array->Length() != nimiq_hash_size(algorithm) || in_array->Length() != nimiq_hash_size(algorithm)) {
+        Local<Value> argv[] = {New<Number>(NIMIQ_HASH_INVALID_ALGORITHM)};
+        Nan::Call(*callback, 1, argv);
+        delete callback;
+        return;
+    }
+    void* out = buffer_data(out_array);
+    void* in = buffer_data(in_array);
+
+    HashChainWorker* worker = new HashChainWorker(callback, out, in, algorithm, depth);
+    worker->SaveToPersistent("out", out_array);
+    worker->SaveToPersistent("in", in_array);
+    AsyncQueueWorker(worker);
+}
+
+NAN_METHOD(node_hash_chain_verify) {
+    Local<Uint8Array> root_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> in_array = info[1].As<Uint8Array>();
+    uint32_t algorithm = To<uint32_t>(info[2]).FromJust();
+    uint32_t depth = To<uint32_t>(info[3]).FromJust();
+    if (nimiq_hash_size(algorithm) == 0 || root_array->Length() != nimiq_hash_size(algorithm) || in_array->Length() != nimiq_hash_size(algorithm)) {
+        info.GetReturnValue().Set(New<Number>(NIMIQ_HASH_INVALID_ALGORITHM));
+        return;
+    }
+    void* root = buffer_data(root_array);
+    void* in = buffer_data(in_array);
+
+    info.GetReturnValue().Set(New<Number>(nimiq_hash_chain_verify(root, in, algorithm, depth)));
+}
+
 NAN_METHOD(node_ed25519_public_key_derive) {
     Local<Uint8Array> out_array = info[0].As<Uint8Array>();
     Local<Uint8Array> in_array = info[1].As<Uint8Array>();
@@ -182,6 +690,86 @@ NAN_METHOD(node_ed25519_public_key_derive) {
     ed25519_public_key_derive(out, in);
 }
 
+// Arguments from offset on: public keys, addresses (each optional), private keys
+static bool public_keys_derive_arguments(const Nan::FunctionCallbackInfo<Value>& info, int offset, uint8_t** public_keys, uint8_t** addresses,
+        uint8_t** private_keys, uint32_t* count) {
+    Local<Uint8Array> private_keys_array = info[offset + 2].As<Uint8Array>();
+    *count = private_keys_array->Length() / NIMIQ_PUBLIC_KEY_SIZE;
+    if (private_keys_array->Length() != (size_t) *count * NIMIQ_PUBLIC_KEY_SIZE) return false;
+
+    if (!optional_buffer_data(info[offset], (size_t) *count * NIMIQ_PUBLIC_KEY_SIZE, public_keys)
+            || !optional_buffer_data(info[offset + 1], (size_t) *count * NIMIQ_ADDRESS_SIZE, addresses)) return false;
+    *private_keys = (uint8_t*) buffer_data(private_keys_array);
+    return true;
+}
+
+NAN_METHOD(node_ed25519_public_keys_derive) {
+    uint8_t *public_keys, *addresses, *private_keys;
+    uint32_t count;
+    if (!public_keys_derive_arguments(info, 0, &public_keys, &addresses, &private_keys, &count)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+    nimiq_public_keys_derive(public_keys, addresses, private_keys, count);
+}
+
+NAN_METHOD(node_ed25519_public_keys_derive_async) {
+    uint8_t *public_keys, *addresses, *private_keys;
+    uint32_t count;
+    if (!public_keys_derive_arguments(info, 1, &public_keys, &addresses, &private_keys, &count)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    Callback* callback = new Callback(info[0].As<Function>());
+    PublicKeysDeriveWorker* worker = new PublicKeysDeriveWorker(callback, public_keys, addresses, private_keys, count);
+    if (public_keys) worker->SaveToPersistent("public_keys", info[1]);
+    if (addresses) worker->SaveToPersistent("addresses", info[2]);
+    worker->SaveToPersistent("private_keys", info[3]);
+    AsyncQueueWorker(worker);
+}
+
+// Arguments from offset on: private keys, public keys, addresses (each optional)
+static bool key_pairs_generate_arguments(const Nan::FunctionCallbackInfo<Value>& info, int offset, uint8_t** private_keys, uint8_t** public_keys,
+        uint8_t** addresses, uint32_t* count) {
+    Local<Uint8Array> private_keys_array = info[offset].As<Uint8Array>();
+    *count = private_keys_array->Length() / NIMIQ_PRIVATE_KEY_SIZE;
+    if (private_keys_array->Length() != (size_t) *count * NIMIQ_PRIVATE_KEY_SIZE) return false;
+
+    if (!optional_buffer_data(info[offset + 1], (size_t) *count * NIMIQ_PUBLIC_KEY_SIZE, public_keys)
+            || !optional_buffer_data(info[offset + 2], (size_t) *count * NIMIQ_ADDRESS_SIZE, addresses)) return false;
+    *private_keys = (uint8_t*) buffer_data(private_keys_array);
+    return true;
+}
+
+NAN_METHOD(node_ed25519_key_pairs_generate) {
+    uint8_t *private_keys, *public_keys, *addresses;
+    uint32_t count;
+    if (!key_pairs_generate_arguments(info, 0, &private_keys, &public_keys, &addresses, &count)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+    if (nimiq_key_pairs_generate(private_keys, public_keys, addresses, count) != 0) {
+        Nan::ThrowError("Failed to obtain randomness from the operating system");
+    }
+}
+
+NAN_METHOD(node_ed25519_key_pairs_generate_async) {
+    uint8_t *private_keys, *public_keys, *addresses;
+    uint32_t count;
+    if (!key_pairs_generate_arguments(info, 1, &private_keys, &public_keys, &addresses, &count)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    Callback* callback = new Callback(info[0].As<Function>());
+    KeyPairsGenerateWorker* worker = new KeyPairsGenerateWorker(callback, private_keys, public_keys, addresses, count);
+    worker->SaveToPersistent("private_keys", info[1]);
+    if (public_keys) worker->SaveToPersistent("public_keys", info[2]);
+    if (addresses) worker->SaveToPersistent("addresses", info[3]);
+    AsyncQueueWorker(worker);
+}
+
 NAN_METHOD(node_ed25519_hash_public_keys) {
     Local<Uint8Array> out_array = info[0].As<Uint8Array>();
     Local<Uint8Array> in_array = info[1].As<Uint8Array>();
@@ -211,7 +799,7 @@ NAN_METHOD(node_ed25519_delinearize_public_key) {
     uint8_t* key = (uint8_t*) key_array->Buffer()->GetContents().Data();
 #endif
 
-    ed25519_delinearize_public_key(out, hash, key);
+    info.GetReturnValue().Set(New<Number>(ed25519_delinearize_public_key(out, hash, key)));
 }
 
 NAN_METHOD(node_ed25519_aggregate_delinearized_public_keys) {
@@ -229,7 +817,7 @@ NAN_METHOD(node_ed25519_aggregate_delinearized_public_keys) {
     uint8_t* keys = (uint8_t*) keys_array->Buffer()->GetContents().Data();
 #endif
 
-    ed25519_aggregate_delinearized_public_keys(out, hash, keys, length);
+    info.GetReturnValue().Set(New<Number>(ed25519_aggregate_delinearized_public_keys(out, hash, keys, length)));
 }
 
 NAN_METHOD(node_ed25519_add_scalars) {
@@ -287,7 +875,366 @@ NAN_METHOD(node_ed25519_verify) {
     uint8_t* pubkey = (uint8_t*) pubkey_array->Buffer()->GetContents().Data();
 #endif
 
-    info.GetReturnValue().Set(New<Number>(ed25519_verify(signature, message, message_length, pubkey)));
+    info.GetReturnValue().Set(New<Number>(ed25519_verify_cached(signature, message, message_length, pubkey)));
+}
+
+NAN_METHOD(node_ed25519_key_cache_stats) {
+    uint64_t hits, misses;
+    key_cache_stats(&hits, &misses);
+
+    Local<Object> stats = New<Object>();
+    Set(stats, New<String>("hits").ToLocalChecked(), New<Number>((double) hits));
+    Set(stats, New<String>("misses").ToLocalChecked(), New<Number>((double) misses));
+    info.GetReturnValue().Set(stats);
+}
+
+NAN_METHOD(node_ed25519_signature_cache_stats) {
+    uint64_t hits, misses;
+    sig_cache_stats(&hits, &misses);
+
+    Local<Object> stats = New<Object>();
+    Set(stats, New<String>("hits").ToLocalChecked(), New<Number>((double) hits));
+    Set(stats, New<String>("misses").ToLocalChecked(), New<Number>((double) misses));
+    info.GetReturnValue().Set(stats);
+}
+
+NAN_METHOD(node_ed25519_verify_batch) {
+    Local<Uint8Array> valid_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> signatures_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> messages_array = info[2].As<Uint8Array>();
+    Local<Uint32Array> lens_array = info[3].As<Uint32Array>();
+    Local<Uint8Array> pubkeys_array = info[4].As<Uint8Array>();
+    Local<Uint8Array> randomness_array = info[5].As<Uint8Array>();
+    uint32_t count = lens_array->Length();
+
+    uint8_t* valid = (uint8_t*) buffer_data(valid_array);
+    uint8_t* signatures = (uint8_t*) buffer_data(signatures_array);
+    uint8_t* messages = (uint8_t*) buffer_data(messages_array);
+    uint32_t* lens = (uint32_t*) buffer_data(lens_array);
+    uint8_t* pubkeys = (uint8_t*) buffer_data(pubkeys_array);
+    uint8_t* randomness = (uint8_t*) buffer_data(randomness_array);
+
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < count; ++i) total += lens[i];
+    if (valid_array->Length() < count || signatures_array->Length() != 64 * (size_t) count
+        || pubkeys_array->Length() != 32 * (size_t) count || randomness_array->Length() != 32
+        || total > messages_array->Length()) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    info.GetReturnValue().Set(New<Number>(ed25519_verify_batch(valid, signatures, messages, lens, pubkeys, count, randomness)));
+}
+
+NAN_METHOD(node_ed25519_verify_many_async) {
+    Local<Uint8Array> valid_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> signatures_array = info[2].As<Uint8Array>();
+    Local<Uint8Array> messages_array = info[3].As<Uint8Array>();
+    Local<Uint32Array> lens_array = info[4].As<Uint32Array>();
+    Local<Uint8Array> pubkeys_array = info[5].As<Uint8Array>();
+    uint32_t count = lens_array->Length();
+
+    uint8_t* valid = (uint8_t*) buffer_data(valid_array);
+    uint8_t* signatures = (uint8_t*) buffer_data(signatures_array);
+    uint8_t* messages = (uint8_t*) buffer_data(messages_array);
+    uint32_t* lens = (uint32_t*) buffer_data(lens_array);
+    uint8_t* pubkeys = (uint8_t*) buffer_data(pubkeys_array);
+
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < count; ++i) total += lens[i];
+    if (valid_array->Length() < count || signatures_array->Length() != 64 * (size_t) count
+        || pubkeys_array->Length() != 32 * (size_t) count || total > messages_array->Length()) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    Callback* callback = new Callback(info[0].As<Function>());
+    VerifyManyWorker* worker = new VerifyManyWorker(callback, valid, signatures, messages, lens, pubkeys, count);
+    worker->SaveToPersistent("valid", valid_array);
+    worker->SaveToPersistent("signatures", signatures_array);
+    worker->SaveToPersistent("messages", messages_array);
+    worker->SaveToPersistent("lens", lens_array);
+    worker->SaveToPersistent("pubkeys", pubkeys_array);
+    AsyncQueueWorker(worker);
+}
+
+NAN_METHOD(node_signature_proof_verify) {
+    Local<Uint8Array> proof_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> message_array = info[2].As<Uint8Array>();
+    uint8_t* sender;
+    if (!optional_buffer_data(info[1], NIMIQ_ADDRESS_SIZE, &sender)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    uint8_t* proof = (uint8_t*) buffer_data(proof_array);
+    uint8_t* message = (uint8_t*) buffer_data(message_array);
+
+    info.GetReturnValue().Set(New<Number>(nimiq_signature_proof_verify(proof, proof_array->Length(), sender, message, message_array->Length())));
+}
+
+NAN_METHOD(node_signature_proofs_verify_async) {
+    Local<Uint8Array> results_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> proofs_array = info[2].As<Uint8Array>();
+    Local<Uint32Array> proof_lens_array = info[3].As<Uint32Array>();
+    Local<Uint8Array> messages_array = info[5].As<Uint8Array>();
+    Local<Uint32Array> message_lens_array = info[6].As<Uint32Array>();
+    uint32_t count = proof_lens_array->Length();
+    uint8_t* senders;
+    bool senders_valid = optional_buffer_data(info[4], (size_t) count * NIMIQ_ADDRESS_SIZE, &senders);
+
+    uint8_t* results = (uint8_t*) buffer_data(results_array);
+    uint8_t* proofs = (uint8_t*) buffer_data(proofs_array);
+    uint32_t* proof_lens = (uint32_t*) buffer_data(proof_lens_array);
+    uint8_t* messages = (uint8_t*) buffer_data(messages_array);
+    uint32_t* message_lens = (uint32_t*) buffer_data(message_lens_array);
+
+    uint64_t proofs_total = 0, messages_total = 0;
+    for (uint32_t i = 0; i < count; ++i) proofs_total += proof_lens[i];
+    if (message_lens_array->Length() == count) {
+        for (uint32_t i = 0; i < count; ++i) messages_total += message_lens[i];
+    }
+    if (results_array->Length() < count || message_lens_array->Length() != count
+        || proofs_total > proofs_array->Length() || messages_total > messages_array->Length()
+        || !senders_valid) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    Callback* callback = new Callback(info[0].As<Function>());
+    SignatureProofsVerifyWorker* worker = new SignatureProofsVerifyWorker(callback, results, proofs, proof_lens, senders, messages, message_lens, count);
+    worker->SaveToPersistent("results", results_array);
+    worker->SaveToPersistent("proofs", proofs_array);
+    worker->SaveToPersistent("proof_lens", proof_lens_array);
+    if (senders) worker->SaveToPersistent("senders", info[4]);
+    worker->SaveToPersistent("messages", messages_array);
+    worker->SaveToPersistent("message_lens", message_lens_array);
+    AsyncQueueWorker(worker);
+}
+
+NAN_METHOD(node_ed25519_expand_key) {
+    Local<Uint8Array> key_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> pubkey_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> privkey_array = info[2].As<Uint8Array>();
+    if (key_array->Length() != sizeof(ed25519_expanded_key) || pubkey_array->Length() != 32 || privkey_array->Length() != 32) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    void* key_data = buffer_data(key_array);
+    uint8_t* pubkey = (uint8_t*) buffer_data(pubkey_array);
+    uint8_t* privkey = (uint8_t*) buffer_data(privkey_array);
+
+    // The key lives in a JS buffer without alignment guarantees, so it is copied in and out.
+    ed25519_expanded_key key;
+    ed25519_expand_key(&key, privkey);
+    memcpy(key_data, &key, sizeof(key));
+    memcpy(pubkey, key.public_key, 32);
+}
+
+NAN_METHOD(node_ed25519_sign_expanded) {
+    Local<Uint8Array> out_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> message_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> key_array = info[2].As<Uint8Array>();
+    uint32_t message_length = message_array->Length();
+    if (out_array->Length() != 64 || key_array->Length() != sizeof(ed25519_expanded_key)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    uint8_t* out = (uint8_t*) buffer_data(out_array);
+    uint8_t* message = (uint8_t*) buffer_data(message_array);
+    void* key_data = buffer_data(key_array);
+
+    ed25519_expanded_key key;
+    memcpy(&key, key_data, sizeof(key));
+    ed25519_sign_expanded(out, message, message_length, &key);
+}
+
+NAN_METHOD(node_ed25519_sign_many) {
+    Local<Uint8Array> signatures_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> messages_array = info[1].As<Uint8Array>();
+    Local<Uint32Array> lens_array = info[2].As<Uint32Array>();
+    Local<Uint8Array> key_array = info[3].As<Uint8Array>();
+    uint32_t count = lens_array->Length();
+
+    uint8_t* signatures = (uint8_t*) buffer_data(signatures_array);
+    uint8_t* messages = (uint8_t*) buffer_data(messages_array);
+    uint32_t* lens = (uint32_t*) buffer_data(lens_array);
+    void* key_data = buffer_data(key_array);
+
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < count; ++i) total += lens[i];
+    if (signatures_array->Length() != 64 * (size_t) count || total > messages_array->Length()
+        || key_array->Length() != sizeof(ed25519_expanded_key)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    ed25519_expanded_key key;
+    memcpy(&key, key_data, sizeof(key));
+    ed25519_sign_many(signatures, messages, lens, count, &key);
+}
+
+NAN_METHOD(node_ed25519_sign_many_async) {
+    Local<Uint8Array> signatures_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> messages_array = info[2].As<Uint8Array>();
+    Local<Uint32Array> lens_array = info[3].As<Uint32Array>();
+    Local<Uint8Array> key_array = info[4].As<Uint8Array>();
+    uint32_t count = lens_array->Length();
+
+    uint8_t* signatures = (uint8_t*) buffer_data(signatures_array);
+    uint8_t* messages = (uint8_t*) buffer_data(messages_array);
+    uint32_t* lens = (uint32_t*) buffer_data(lens_array);
+    void* key_data = buffer_data(key_array);
+
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < count; ++i) total += lens[i];
+    if (signatures_array->Length() != 64 * (size_t) count || total > messages_array->Length()
+        || key_array->Length() != sizeof(ed25519_expanded_key)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    ed25519_expanded_key key;
+    memcpy(&key, key_data, sizeof(key));
+    Callback* callback = new Callback(info[0].As<Function>());
+    SignManyWorker* worker = new SignManyWorker(callback, signatures, messages, lens, count, &key);
+    worker->SaveToPersistent("signatures", signatures_array);
+    worker->SaveToPersistent("messages", messages_array);
+    worker->SaveToPersistent("lens", lens_array);
+    AsyncQueueWorker(worker);
+}
+
+NAN_METHOD(node_ed25519_multisig_context_init) {
+    Local<Uint8Array> context_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> aggregate_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> pubkeys_array = info[2].As<Uint8Array>();
+    bool has_private_key = info.Length() > 4 && info[4]->IsUint8Array();
+    uint32_t count = pubkeys_array->Length() / 32;
+    if (count == 0 || pubkeys_array->Length() != 32 * (size_t) count
+        || context_array->Length() != ED25519_MULTISIG_CONTEXT_SIZE(count) || aggregate_array->Length() != 32
+        || (has_private_key && (info[3].As<Uint8Array>()->Length() != 32 || info[4].As<Uint8Array>()->Length() != 32))) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    void* context_data = buffer_data(context_array);
+    uint8_t* aggregate = (uint8_t*) buffer_data(aggregate_array);
+    uint8_t* pubkeys = (uint8_t*) buffer_data(pubkeys_array);
+    uint8_t* pubkey = has_private_key ? (uint8_t*) buffer_data(info[3].As<Uint8Array>()) : NULL;
+    uint8_t* privkey = has_private_key ? (uint8_t*) buffer_data(info[4].As<Uint8Array>()) : NULL;
+
+    // The context lives in a JS buffer without alignment guarantees, so it is built in aligned memory and copied out.
+    ed25519_multisig_context* context = (ed25519_multisig_context*) malloc(ED25519_MULTISIG_CONTEXT_SIZE(count));
+    int result = ed25519_multisig_context_init(context, pubkeys, count, pubkey, privkey);
+    if (result) {
+        memcpy(context_data, context, ED25519_MULTISIG_CONTEXT_SIZE(count));
+        memcpy(aggregate, context->aggregate_public_key, 32);
+    }
+    free(context);
+    info.GetReturnValue().Set(New<Number>(result));
+}
+
+NAN_METHOD(node_ed25519_multisig_partial_sign) {
+    Local<Uint8Array> out_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> message_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> commitment_array = info[2].As<Uint8Array>();
+    Local<Uint8Array> secret_array = info[3].As<Uint8Array>();
+    Local<Uint8Array> context_array = info[4].As<Uint8Array>();
+    uint32_t message_length = message_array->Length();
+    if (out_array->Length() != 32 || commitment_array->Length() != 32 || secret_array->Length() != 32
+        || context_array->Length() < sizeof(ed25519_multisig_context)) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    uint8_t* out = (uint8_t*) buffer_data(out_array);
+    uint8_t* message = (uint8_t*) buffer_data(message_array);
+    uint8_t* commitment = (uint8_t*) buffer_data(commitment_array);
+    uint8_t* secret = (uint8_t*) buffer_data(secret_array);
+    void* context_data = buffer_data(context_array);
+
+    // Signing only needs the fixed part of the context.
+    ed25519_multisig_context context;
+    memcpy(&context, context_data, sizeof(context));
+    ed25519_multisig_partial_sign(out, message, message_length, commitment, secret, &context);
+}
+
+// Copies the full context, with the cosigners, out of a JS buffer, which has no alignment guarantee.
+static ed25519_multisig_context* copy_multisig_context(Local<Uint8Array> context_array) {
+    void* context_data = buffer_data(context_array);
+    uint32_t count;
+    if (context_array->Length() < sizeof(ed25519_multisig_context)) return NULL;
+    memcpy(&count, (uint8_t*) context_data + offsetof(ed25519_multisig_context, num_cosigners), sizeof(count));
+    if (context_array->Length() != ED25519_MULTISIG_CONTEXT_SIZE(count)) return NULL;
+
+    ed25519_multisig_context* context = (ed25519_multisig_context*) malloc(ED25519_MULTISIG_CONTEXT_SIZE(count));
+    memcpy(context, context_data, ED25519_MULTISIG_CONTEXT_SIZE(count));
+    return context;
+}
+
+NAN_METHOD(node_ed25519_multisig_verify_partial) {
+    Local<Uint8Array> partial_signature_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> commitment_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> message_array = info[2].As<Uint8Array>();
+    Local<Uint8Array> aggregate_commitment_array = info[3].As<Uint8Array>();
+    uint32_t cosigner = To<uint32_t>(info[4]).FromJust();
+    uint32_t message_length = message_array->Length();
+    if (partial_signature_array->Length() != 32 || commitment_array->Length() != 32
+        || aggregate_commitment_array->Length() != 32) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    uint8_t* partial_signature = (uint8_t*) buffer_data(partial_signature_array);
+    uint8_t* commitment = (uint8_t*) buffer_data(commitment_array);
+    uint8_t* message = (uint8_t*) buffer_data(message_array);
+    uint8_t* aggregate_commitment = (uint8_t*) buffer_data(aggregate_commitment_array);
+
+    ed25519_multisig_context* context = copy_multisig_context(info[5].As<Uint8Array>());
+    if (!context) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+    int result = ed25519_multisig_verify_partial(partial_signature, commitment, message, message_length, aggregate_commitment, cosigner, context);
+    free(context);
+    info.GetReturnValue().Set(New<Number>(result));
+}
+
+NAN_METHOD(node_ed25519_multisig_verify_partials) {
+    Local<Uint8Array> valid_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> partial_signatures_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> commitments_array = info[2].As<Uint8Array>();
+    Local<Uint8Array> message_array = info[3].As<Uint8Array>();
+    Local<Uint8Array> aggregate_commitment_array = info[4].As<Uint8Array>();
+    Local<Uint8Array> randomness_array = info[6].As<Uint8Array>();
+    uint32_t message_length = message_array->Length();
+
+    uint8_t* valid = (uint8_t*) buffer_data(valid_array);
+    uint8_t* partial_signatures = (uint8_t*) buffer_data(partial_signatures_array);
+    uint8_t* commitments = (uint8_t*) buffer_data(commitments_array);
+    uint8_t* message = (uint8_t*) buffer_data(message_array);
+    uint8_t* aggregate_commitment = (uint8_t*) buffer_data(aggregate_commitment_array);
+    uint8_t* randomness = (uint8_t*) buffer_data(randomness_array);
+
+    ed25519_multisig_context* context = copy_multisig_context(info[5].As<Uint8Array>());
+    if (!context) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+    size_t count = context->num_cosigners;
+    if (valid_array->Length() < count || partial_signatures_array->Length() != 32 * count
+        || commitments_array->Length() != 32 * count || aggregate_commitment_array->Length() != 32
+        || randomness_array->Length() != 32) {
+        free(context);
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    int result = ed25519_multisig_verify_partials(valid, partial_signatures, commitments, message, message_length, aggregate_commitment, context, randomness);
+    free(context);
+    info.GetReturnValue().Set(New<Number>(result));
 }
 
 NAN_METHOD(node_kdf_legacy) {
@@ -349,7 +1296,7 @@ NAN_METHOD(node_ed25519_aggregate_commitments) {
     uint8_t* in = (uint8_t*) in_array->Buffer()->GetContents().Data();
 #endif
 
-    ed25519_aggregate_commitments(out, in, length);
+    info.GetReturnValue().Set(New<Number>(ed25519_aggregate_commitments(out, in, length)));
 }
 
 NAN_METHOD(node_ed25519_create_commitment) {
@@ -370,6 +1317,24 @@ NAN_METHOD(node_ed25519_create_commitment) {
     ed25519_create_commitment(out_secret, out_commitment, in);
 }
 
+NAN_METHOD(node_ed25519_create_commitments) {
+    Local<Uint8Array> out_secrets_array = info[0].As<Uint8Array>();
+    Local<Uint8Array> out_commitments_array = info[1].As<Uint8Array>();
+    Local<Uint8Array> randomness_array = info[2].As<Uint8Array>();
+    size_t count = randomness_array->Length() / 32;
+    if (randomness_array->Length() != 32 * count || out_secrets_array->Length() != 32 * count
+        || out_commitments_array->Length() != 32 * count) {
+        Nan::ThrowRangeError("Invalid buffer sizes");
+        return;
+    }
+
+    uint8_t* out_secrets = (uint8_t*) buffer_data(out_secrets_array);
+    uint8_t* out_commitments = (uint8_t*) buffer_data(out_commitments_array);
+    uint8_t* randomness = (uint8_t*) buffer_data(randomness_array);
+
+    info.GetReturnValue().Set(New<Number>(ed25519_create_commitments(out_secrets, out_commitments, randomness, count)));
+}
+
 NAN_METHOD(node_ed25519_derive_delinearized_private_key) {
     Local<Uint8Array> out_array = info[0].As<Uint8Array>();
     Local<Uint8Array> in_hash_array = info[1].As<Uint8Array>();
@@ -430,14 +1395,51 @@ NAN_MODULE_INIT(Init) {
         GetFunction(New<FunctionTemplate>(node_sha256)).ToLocalChecked());
     Set(target, New<String>("node_sha512").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_sha512)).ToLocalChecked());
+    Set(target, New<String>("node_sha256_batch").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_sha256_batch)).ToLocalChecked());
+    Set(target, New<String>("node_sha512_batch").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_sha512_batch)).ToLocalChecked());
+    Set(target, New<String>("node_hmac_sha512_init").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_hmac_sha512_init)).ToLocalChecked());
+    Set(target, New<String>("node_hmac_sha512").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_hmac_sha512)).ToLocalChecked());
+    Set(target, New<String>("node_pbkdf2_sha512").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_pbkdf2_sha512)).ToLocalChecked());
+    Set(target, New<String>("node_pbkdf2_sha512_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_pbkdf2_sha512_async)).ToLocalChecked());
+    Set(target, New<String>("node_slip10_master_key").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_slip10_master_key)).ToLocalChecked());
+    Set(target, New<String>("node_slip10_derive_range").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_slip10_derive_range)).ToLocalChecked());
+    Set(target, New<String>("node_slip10_derive_range_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_slip10_derive_range_async)).ToLocalChecked());
+    Set(target, New<String>("node_vanity_search").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_vanity_search)).ToLocalChecked());
+    Set(target, New<String>("node_vanity_search_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_vanity_search_async)).ToLocalChecked());
+    Set(target, New<String>("HMAC_SHA512_CONTEXT_SIZE").ToLocalChecked(), New<Number>(sizeof(hmac_sha512_context)));
     Set(target, New<String>("node_blake2").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_blake2)).ToLocalChecked());
     Set(target, New<String>("node_argon2").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_argon2)).ToLocalChecked());
     Set(target, New<String>("node_argon2_async").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_argon2_async)).ToLocalChecked());
+    Set(target, New<String>("node_hash_chain").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_hash_chain)).ToLocalChecked());
+    Set(target, New<String>("node_hash_chain_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_hash_chain_async)).ToLocalChecked());
+    Set(target, New<String>("node_hash_chain_verify").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_hash_chain_verify)).ToLocalChecked());
     Set(target, New<String>("node_ed25519_public_key_derive").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_ed25519_public_key_derive)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_public_keys_derive").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_public_keys_derive)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_public_keys_derive_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_public_keys_derive_async)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_key_pairs_generate").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_key_pairs_generate)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_key_pairs_generate_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_key_pairs_generate_async)).ToLocalChecked());
     Set(target, New<String>("node_ed25519_hash_public_keys").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_ed25519_hash_public_keys)).ToLocalChecked());
     Set(target, New<String>("node_ed25519_delinearize_public_key").ToLocalChecked(),
@@ -450,6 +1452,37 @@ NAN_MODULE_INIT(Init) {
         GetFunction(New<FunctionTemplate>(node_ed25519_sign)).ToLocalChecked());
     Set(target, New<String>("node_ed25519_verify").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_ed25519_verify)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_verify_batch").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_verify_batch)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_verify_many_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_verify_many_async)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_key_cache_stats").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_key_cache_stats)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_signature_cache_stats").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_signature_cache_stats)).ToLocalChecked());
+    Set(target, New<String>("node_signature_proof_verify").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_signature_proof_verify)).ToLocalChecked());
+    Set(target, New<String>("node_signature_proofs_verify_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_signature_proofs_verify_async)).ToLocalChecked());
+    Set(target, New<String>("ED25519_EXPANDED_KEY_SIZE").ToLocalChecked(), New<Number>(sizeof(ed25519_expanded_key)));
+    Set(target, New<String>("node_ed25519_expand_key").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_expand_key)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_sign_expanded").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_sign_expanded)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_sign_many").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_sign_many)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_sign_many_async").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_sign_many_async)).ToLocalChecked());
+    Set(target, New<String>("ED25519_MULTISIG_CONTEXT_SIZE").ToLocalChecked(), New<Number>(sizeof(ed25519_multisig_context)));
+    Set(target, New<String>("ED25519_MULTISIG_COSIGNER_SIZE").ToLocalChecked(), New<Number>(sizeof(ed25519_multisig_cosigner)));
+    Set(target, New<String>("node_ed25519_multisig_context_init").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_multisig_context_init)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_multisig_partial_sign").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_multisig_partial_sign)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_multisig_verify_partial").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_multisig_verify_partial)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_multisig_verify_partials").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_multisig_verify_partials)).ToLocalChecked());
     Set(target, New<String>("node_kdf_legacy").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_kdf_legacy)).ToLocalChecked());
     Set(target, New<String>("node_kdf").ToLocalChecked(),
@@ -458,6 +1491,8 @@ NAN_MODULE_INIT(Init) {
         GetFunction(New<FunctionTemplate>(node_ed25519_aggregate_commitments)).ToLocalChecked());
     Set(target, New<String>("node_ed25519_create_commitment").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_ed25519_create_commitment)).ToLocalChecked());
+    Set(target, New<String>("node_ed25519_create_commitments").ToLocalChecked(),
+        GetFunction(New<FunctionTemplate>(node_ed25519_create_commitments)).ToLocalChecked());
     Set(target, New<String>("node_ed25519_derive_delinearized_private_key").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(node_ed25519_derive_delinearized_private_key)).ToLocalChecked());
     Set(target, New<String>("node_ed25519_delinearized_partial_sign").ToLocalChecked(),
@@ -3,9 +3,27 @@
 #include <stdio.h>
 #include <sys/time.h>
 #include "nimiq_native.h"
+#include "slip10.h"
+#include "vanity.h"
+#include "ed25519/ed25519.h"
+#include "ed25519/key_cache.h"
+#include "ed25519/sig_cache.h"
 
 #define HARD_COUNT 100
 #define LIGHT_COUNT 10000000
+#define CHAIN_COUNT 10000
+#define CHAIN_DEPTH 255
+#define BULK_SIZE (1024 * 1024)
+#define BULK_COUNT 256
+#define BATCH_SIZE 1024
+#define BATCH_MSG_SIZE 150
+#define BATCH_COUNT 200
+#define PBKDF2_COUNT 500
+#define PBKDF2_ITERATIONS 2048
+#define DERIVE_COUNT 10000
+#define VANITY_COUNT 20000
+#define VERIFY_COUNT 1024
+#define VERIFY_MSG_SIZE 150
 
 int main() {
     long start, end;
@@ -46,6 +64,231 @@ int main() {
     printf("Light %ldms => %ld kH/s\n", end-start, (LIGHT_COUNT)/(end-start));
     start = end;
 
+    for(int i = 0; i < CHAIN_COUNT; ++i) {
+        nimiq_hash_chain(out, out, NIMIQ_HASH_BLAKE2B, CHAIN_DEPTH);
+    }
+
+    gettimeofday(&timecheck, NULL);
+    end = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+    printf("Chain Blake2b(%d) %ldms => %ld chains/s\n", CHAIN_DEPTH, end-start, (CHAIN_COUNT*1000L)/(end-start));
+    start = end;
+
+    for(int i = 0; i < CHAIN_COUNT; ++i) {
+        nimiq_hash_chain(out, out, NIMIQ_HASH_SHA256, CHAIN_DEPTH);
+    }
+
+    gettimeofday(&timecheck, NULL);
+    end = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+    printf("Chain SHA-256(%d) %ldms => %ld chains/s\n", CHAIN_DEPTH, end-start, (CHAIN_COUNT*1000L)/(end-start));
+    start = end;
+
+    char* bulk = calloc(BULK_SIZE, 1);
+    for(int i = 0; i < BULK_COUNT; ++i) {
+        nimiq_sha256(out, bulk, BULK_SIZE);
+        bulk[0]++;
+    }
+    free(bulk);
+
+    gettimeofday(&timecheck, NULL);
+    end = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+    printf("SHA-256(1 MiB) %ldms => %ld MiB/s\n", end-start, (BULK_COUNT*1000L)/(end-start));
+    start = end;
+
+    char* batch_in = calloc(BATCH_SIZE, BATCH_MSG_SIZE);
+    char* batch_out = malloc(BATCH_SIZE * 64);
+    uint32_t* batch_lens = malloc(BATCH_SIZE * sizeof(uint32_t));
+    for(int i = 0; i < BATCH_SIZE; ++i) {
+        batch_lens[i] = BATCH_MSG_SIZE;
+    }
+    const char* batch_names[] = {"SHA-256", "SHA-512"};
+    for(int alg = 0; alg < 2; ++alg) {
+        for(int i = 0; i < BATCH_COUNT; ++i) {
+            for(int j = 0; j < BATCH_SIZE; ++j) {
+                if (alg == 0) nimiq_sha256(batch_out + 64 * j, batch_in + BATCH_MSG_SIZE * j, BATCH_MSG_SIZE);
+                else nimiq_sha512(batch_out + 64 * j, batch_in + BATCH_MSG_SIZE * j, BATCH_MSG_SIZE);
+            }
+            batch_in[0]++;
+        }
+
+        gettimeofday(&timecheck, NULL);
+        end = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+        printf("%s(%d B) serial %ldms => %ld kH/s\n", batch_names[alg], BATCH_MSG_SIZE, end-start, (BATCH_COUNT*BATCH_SIZE)/(end-start));
+        start = end;
+
+        for(int i = 0; i < BATCH_COUNT; ++i) {
+            if (alg == 0) nimiq_sha256_batch(batch_out, batch_in, batch_lens, BATCH_SIZE);
+            else nimiq_sha512_batch(batch_out, batch_in, batch_lens, BATCH_SIZE);
+            batch_in[0]++;
+        }
+
+        gettimeofday(&timecheck, NULL);
+        end = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+        printf("%s(%d B) batch(%d) %ldms => %ld kH/s\n", batch_names[alg], BATCH_MSG_SIZE, BATCH_SIZE, end-start, (BATCH_COUNT*BATCH_SIZE)/(end-start));
+        start = end;
+    }
+    free(batch_in);
+    free(batch_out);
+    free(batch_lens);
+
+    char* mnemonic = strdup("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about");
+    char* seed = malloc(64);
+    for(int i = 0; i < PBKDF2_COUNT; ++i) {
+        nimiq_pbkdf2_sha512(seed, 64, mnemonic, strlen(mnemonic), "mnemonic", 8, PBKDF2_ITERATIONS);
+        mnemonic[0]++;
+    }
+    free(mnemonic);
+    free(seed);
+
+    gettimeofday(&timecheck, NULL);
+    end = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+    printf("PBKDF2-SHA512(%d) %ldms => %ld seeds/s\n", PBKDF2_ITERATIONS, end-start, (PBKDF2_COUNT*1000L)/(end-start));
+    start = end;
+
+    uint8_t master[SLIP10_EXTENDED_KEY_SIZE];
+    uint32_t derive_path[] = {44, 242, 0, 0};
+    uint8_t* derive_addresses = malloc(DERIVE_COUNT * SLIP10_ADDRESS_SIZE);
+    slip10_master_key(master, (uint8_t*) "Test1", 5);
+    slip10_derive_range(NULL, NULL, derive_addresses, master, derive_path, 4, 3, 0, DERIVE_COUNT);
+    free(derive_addresses);
+
+    gettimeofday(&timecheck, NULL);
+    end = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+    printf("SLIP-0010 m/44'/242'/0'/i' %ldms => %ld addresses/s\n", end-start, (DERIVE_COUNT*1000L)/(end-start));
+    start = end;
+
+    uint8_t vanity_key[VANITY_KEY_SIZE] = {0};
+    uint8_t vanity_pattern[] = {31, 31, 31, 31, 31, 31};
+    uint8_t vanity_match[VANITY_SEED_SIZE];
+    vanity_search(vanity_match, 1, vanity_key, 0, VANITY_COUNT, vanity_pattern, sizeof(vanity_pattern), VANITY_MATCH_PREFIX);
+
+    gettimeofday(&timecheck, NULL);
+    end = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+    printf("Vanity search %ldms => %ld candidates/s\n", end-start, (VANITY_COUNT*1000L)/(end-start));
+    start = end;
+
+    uint8_t* verify_signatures = malloc(VERIFY_COUNT * 64);
+    uint8_t* verify_keys = malloc(VERIFY_COUNT * 32);
+    uint8_t* verify_messages = calloc(VERIFY_COUNT, VERIFY_MSG_SIZE);
+    uint8_t* verify_valid = malloc(VERIFY_COUNT);
+    uint32_t* verify_lens = malloc(VERIFY_COUNT * sizeof(uint32_t));
+    uint8_t verify_randomness[32] = {0};
+    for(int i = 0; i < VERIFY_COUNT; ++i) {
+        uint8_t key[32] = {(uint8_t) i, (uint8_t) (i >> 8)};
+        verify_lens[i] = VERIFY_MSG_SIZE;
+        verify_messages[i * VERIFY_MSG_SIZE] = (uint8_t) i;
+        ed25519_public_key_derive(verify_keys + 32 * i, key);
+    }
+
+    gettimeofday(&timecheck, NULL);
+    long ustart = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    for(int i = 0; i < VERIFY_COUNT; ++i) {
+        uint8_t key[32] = {(uint8_t) i, (uint8_t) (i >> 8)};
+        ed25519_sign(verify_signatures + 64 * i, verify_messages + i * VERIFY_MSG_SIZE, VERIFY_MSG_SIZE, verify_keys + 32 * i, key);
+    }
+    gettimeofday(&timecheck, NULL);
+    long uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    printf("Ed25519 sign %ldus/sig => %ld sigs/s\n", (uend-ustart)/VERIFY_COUNT, (VERIFY_COUNT*1000000L)/(uend-ustart));
+
+    uint8_t* many_signatures = malloc(VERIFY_COUNT * 64);
+    ed25519_expanded_key expanded_key;
+    ustart = uend;
+    ed25519_expand_key(&expanded_key, verify_randomness);
+    ed25519_sign_many(many_signatures, verify_messages, verify_lens, VERIFY_COUNT, &expanded_key);
+    gettimeofday(&timecheck, NULL);
+    uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    printf("Ed25519 sign many %ldus/sig => %ld sigs/s\n", (uend-ustart)/VERIFY_COUNT, (VERIFY_COUNT*1000000L)/(uend-ustart));
+    free(many_signatures);
+
+    ustart = uend;
+    for(int i = 0; i < VERIFY_COUNT; ++i) {
+        ed25519_verify(verify_signatures + 64 * i, verify_messages + i * VERIFY_MSG_SIZE, VERIFY_MSG_SIZE, verify_keys + 32 * i);
+    }
+    gettimeofday(&timecheck, NULL);
+    uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    printf("Ed25519 verify %ldus/sig => %ld sigs/s\n", (uend-ustart)/VERIFY_COUNT, (VERIFY_COUNT*1000000L)/(uend-ustart));
+
+    uint64_t cache_hits, cache_misses;
+    sig_cache_clear();
+    for(int pass = 0; pass < 2; ++pass) {
+        ustart = uend;
+        for(int i = 0; i < VERIFY_COUNT; ++i) {
+            ed25519_verify_cached(verify_signatures + 64 * i, verify_messages + i * VERIFY_MSG_SIZE, VERIFY_MSG_SIZE, verify_keys + 32 * i);
+        }
+        gettimeofday(&timecheck, NULL);
+        uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+        if (pass == 0) {
+            key_cache_stats(&cache_hits, &cache_misses);
+            printf("Ed25519 verify cached %ldus/sig (key cache: %lu hits, %lu misses)\n", (uend-ustart)/VERIFY_COUNT, (unsigned long) cache_hits, (unsigned long) cache_misses);
+        } else {
+            sig_cache_stats(&cache_hits, &cache_misses);
+            printf("Ed25519 verify cached again %ldus/sig (signature cache: %lu hits, %lu misses)\n", (uend-ustart)/VERIFY_COUNT, (unsigned long) cache_hits, (unsigned long) cache_misses);
+        }
+    }
+
+    for(int n = 1; n <= VERIFY_COUNT; n *= 2) {
+        /* Single signatures are added to the signature cache, don't let later rounds hit it. */
+        sig_cache_clear();
+        ustart = uend;
+        for(int i = 0; i < VERIFY_COUNT; i += n) {
+            ed25519_verify_batch(verify_valid, verify_signatures + 64 * i, verify_messages + i * VERIFY_MSG_SIZE, verify_lens, verify_keys + 32 * i, n, verify_randomness);
+        }
+        gettimeofday(&timecheck, NULL);
+        uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+        printf("Ed25519 verify batch(%d) %ldus/sig\n", n, (uend-ustart)/VERIFY_COUNT);
+    }
+
+    uint8_t public_keys_hash[64];
+    uint8_t aggregate_public_key[32];
+    ed25519_hash_public_keys(public_keys_hash, verify_keys, 256);
+    ustart = uend;
+    ed25519_aggregate_delinearized_public_keys(aggregate_public_key, public_keys_hash, verify_keys, 256);
+    gettimeofday(&timecheck, NULL);
+    uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    printf("Ed25519 aggregate 256 public keys %ldus\n", uend-ustart);
+
+    uint8_t* commitment_secrets = malloc(VERIFY_COUNT * 32);
+    uint8_t* commitments = malloc(VERIFY_COUNT * 32);
+    ustart = uend;
+    for(int i = 0; i < VERIFY_COUNT; ++i) {
+        ed25519_create_commitment(commitment_secrets + 32 * i, commitments + 32 * i, verify_keys + 32 * i);
+    }
+    gettimeofday(&timecheck, NULL);
+    uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    printf("Ed25519 create commitment %ldus/commitment\n", (uend-ustart)/VERIFY_COUNT);
+
+    ustart = uend;
+    ed25519_create_commitments(commitment_secrets, commitments, verify_keys, VERIFY_COUNT);
+    gettimeofday(&timecheck, NULL);
+    uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    printf("Ed25519 create commitments %ldus/commitment\n", (uend-ustart)/VERIFY_COUNT);
+
+    uint8_t aggregate_commitment[32];
+    ustart = uend;
+    ed25519_aggregate_commitments(aggregate_commitment, commitments, VERIFY_COUNT);
+    gettimeofday(&timecheck, NULL);
+    uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    printf("Ed25519 aggregate %d commitments %ldus\n", VERIFY_COUNT, uend-ustart);
+    free(commitment_secrets);
+    free(commitments);
+    uint8_t* derived_keys = malloc(VERIFY_COUNT * NIMIQ_PUBLIC_KEY_SIZE);
+    uint8_t* derived_addresses = malloc(VERIFY_COUNT * NIMIQ_ADDRESS_SIZE);
+    ustart = uend;
+    nimiq_public_keys_derive(derived_keys, derived_addresses, verify_signatures, VERIFY_COUNT);
+    gettimeofday(&timecheck, NULL);
+    uend = (long)timecheck.tv_sec * 1000000 + (long)timecheck.tv_usec;
+    printf("Ed25519 derive public keys and addresses %ldus/key\n", (uend-ustart)/VERIFY_COUNT);
+    free(derived_keys);
+    free(derived_addresses);
+
+    free(verify_signatures);
+    free(verify_keys);
+    free(verify_messages);
+    free(verify_valid);
+    free(verify_lens);
+
+    gettimeofday(&timecheck, NULL);
+    start = (long)timecheck.tv_sec * 1000 + (long)timecheck.tv_usec / 1000;
+
     for(int i = 1; i < 4; ++i) {
         free(in);
         in = malloc(32);
@@ -0,0 +1,72 @@
+#include <string.h>
+
+#include "pbkdf2_sha512.h"
+#include "hmac_sha512.h"
+
+static void store64_be(unsigned char *out, uint64_t x) {
+    int i;
+    for (i = 7; i >= 0; --i, x >>= 8) out[i] = (unsigned char) x;
+}
+
+/*
+ * After the first one, every iteration MACs the previous 64 byte output, so
+ * the inner and outer hashes are a single padded block each. These blocks
+ * are compressed straight from the cached pad states, and the outputs are
+ * accumulated as state words without going through bytes.
+ */
+void pbkdf2_sha512(unsigned char *out, size_t outlen, const unsigned char *password, size_t passlen,
+                   const unsigned char *salt, size_t saltlen, uint32_t iterations) {
+    hmac_sha512_context ctx;
+    sha512_context md;
+    unsigned char block[HMAC_SHA512_BLOCK_SIZE];
+    unsigned char index[4];
+    unsigned char u[HMAC_SHA512_SIZE];
+    uint64_t state[8], acc[8];
+    uint32_t i, j;
+    int k;
+
+    hmac_sha512_init(&ctx, password, passlen);
+
+    /* U || padding || bit length of (pad block || U) */
+    memset(block, 0, sizeof(block));
+    block[HMAC_SHA512_SIZE] = 0x80;
+    store64_be(block + HMAC_SHA512_BLOCK_SIZE - 8, (HMAC_SHA512_BLOCK_SIZE + HMAC_SHA512_SIZE) * 8);
+
+    for (i = 1; outlen > 0; ++i) {
+        size_t n = outlen < HMAC_SHA512_SIZE ? outlen : HMAC_SHA512_SIZE;
+
+        /* U_1 = HMAC(password, salt || INT(i)) */
+        index[0] = (unsigned char) (i >> 24);
+        index[1] = (unsigned char) (i >> 16);
+        index[2] = (unsigned char) (i >> 8);
+        index[3] = (unsigned char) i;
+        md = ctx.inner;
+        sha512_update(&md, salt, saltlen);
+        sha512_update(&md, index, sizeof(index));
+        sha512_final(&md, u);
+        md = ctx.outer;
+        sha512_update(&md, u, sizeof(u));
+        sha512_final(&md, block);
+        memset(acc, 0, sizeof(acc));
+        for (k = 0; k < HMAC_SHA512_SIZE; ++k) acc[k / 8] = (acc[k / 8] << 8) | block[k];
+
+        /* U_j = HMAC(password, U_{j-1}), T = U_1 ^ ... ^ U_c */
+        for (j = 1; j < iterations; ++j) {
+            memcpy(state, ctx.inner.state, sizeof(state));
+            sha512_transform_blocks(state, block, 1);
+            for (k = 0; k < 8; ++k) store64_be(block + 8 * k, state[k]);
+
+            memcpy(state, ctx.outer.state, sizeof(state));
+            sha512_transform_blocks(state, block, 1);
+            for (k = 0; k < 8; ++k) {
+                store64_be(block + 8 * k, state[k]);
+                acc[k] ^= state[k];
+            }
+        }
+
+        for (k = 0; k < 8; ++k) store64_be(u + 8 * k, acc[k]);
+        memcpy(out, u, n);
+        out += n;
+        outlen -= n;
+    }
+}
@@ -0,0 +1,12 @@
+#ifndef __NIMIQ_PBKDF2_SHA512_H
+#define __NIMIQ_PBKDF2_SHA512_H
+
+#include <stddef.h>
+
+#include "ed25519/fixedint.h"
+
+/* PBKDF2 (RFC 2898) with HMAC-SHA512 as pseudorandom function */
+void pbkdf2_sha512(unsigned char *out, size_t outlen, const unsigned char *password, size_t passlen,
+                   const unsigned char *salt, size_t saltlen, uint32_t iterations);
+
+#endif
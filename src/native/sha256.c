@@ -16,8 +16,14 @@
 #include <stdlib.h>
 #include <memory.h>
 #include "sha256.h"
+#include "cpu.h"
+#ifdef NIMIQ_CPU_X86
+#include <immintrin.h>
+#endif
 
 /****************************** MACROS ******************************/
+#define SHA256_MAX_LANES 16
+
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32-(b))))
 #define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32-(b))))
 
@@ -28,6 +34,20 @@
 #define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
+/**************************** DATA TYPES ****************************/
+typedef void (*sha256_blocks_fn)(WORD32 state[8], const BYTE data[], size_t blocks);
+typedef void (*sha256_lanes_fn)(WORD32 state[8][SHA256_MAX_LANES], const BYTE *const blocks[]);
+
+// One message being hashed in a lane of the multi-buffer kernels.
+typedef struct {
+	const BYTE *data;	// next full block of the message
+	size_t blocks;		// full blocks left in the message
+	BYTE tail[128];		// remaining bytes followed by the padding
+	const BYTE *tail_next;	// next block in tail
+	size_t tail_blocks;	// padded blocks left in tail
+	BYTE *out;
+} SHA256_LANE;
+
 /**************************** VARIABLES *****************************/
 static const WORD32 k[64] = {
 	0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
@@ -40,74 +60,191 @@ static const WORD32 k[64] = {
 	0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
 };
 
+static const WORD32 sha256_iv[8] = {
+	0x6a09e667,0xbb67ae85,0x3c6ef372,0xa54ff53a,0x510e527f,0x9b05688c,0x1f83d9ab,0x5be0cd19
+};
+
 /*********************** FUNCTION DEFINITIONS ***********************/
-void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+
+static void sha256_blocks_ref(WORD32 state[8], const BYTE data[], size_t blocks)
 {
 	WORD32 a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
-	for (i = 0, j = 0; i < 16; ++i, j += 4)
-		m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-	for ( ; i < 64; ++i)
-		m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
-
-	a = ctx->state[0];
-	b = ctx->state[1];
-	c = ctx->state[2];
-	d = ctx->state[3];
-	e = ctx->state[4];
-	f = ctx->state[5];
-	g = ctx->state[6];
-	h = ctx->state[7];
-
-	for (i = 0; i < 64; ++i) {
-		t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-		t2 = EP0(a) + MAJ(a,b,c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + t1;
-		d = c;
-		c = b;
-		b = a;
-		a = t1 + t2;
-	}
-
-	ctx->state[0] += a;
-	ctx->state[1] += b;
-	ctx->state[2] += c;
-	ctx->state[3] += d;
-	ctx->state[4] += e;
-	ctx->state[5] += f;
-	ctx->state[6] += g;
-	ctx->state[7] += h;
+	for ( ; blocks > 0; --blocks, data += 64) {
+		for (i = 0, j = 0; i < 16; ++i, j += 4)
+			m[i] = ((WORD32)data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
+		for ( ; i < 64; ++i)
+			m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (i = 0; i < 64; ++i) {
+			t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
+			t2 = EP0(a) + MAJ(a,b,c);
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+	}
+}
+
+#ifdef NIMIQ_CPU_X86
+/*
+ * SHA-256 using the x86 SHA extensions. The state is kept in the ABEF/CDGH
+ * layout expected by sha256rnds2, four message words are scheduled at a time.
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void sha256_blocks_shani(WORD32 state[8], const BYTE data[], size_t blocks)
+{
+	const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0, state1, abef, cdgh, msg, tmp, w[4];
+	int i;
+
+	tmp = _mm_loadu_si128((const __m128i *) &state[0]);
+	state1 = _mm_loadu_si128((const __m128i *) &state[4]);
+	tmp = _mm_shuffle_epi32(tmp, 0xB1);             /* CDAB */
+	state1 = _mm_shuffle_epi32(state1, 0x1B);       /* EFGH */
+	state0 = _mm_alignr_epi8(tmp, state1, 8);       /* ABEF */
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);    /* CDGH */
+
+	for ( ; blocks > 0; --blocks, data += 64) {
+		abef = state0;
+		cdgh = state1;
+
+		for (i = 0; i < 16; ++i) {
+			if (i < 4) {
+				w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (data + 16 * i)), mask);
+			} else {
+				/* w[i] = sigma1/sigma0 schedule of the previous 16 words */
+				tmp = _mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]);
+				tmp = _mm_add_epi32(tmp, _mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4));
+				w[i & 3] = _mm_sha256msg2_epu32(tmp, w[(i + 3) & 3]);
+			}
+			msg = _mm_add_epi32(w[i & 3], _mm_loadu_si128((const __m128i *) &k[4 * i]));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+		}
+
+		state0 = _mm_add_epi32(state0, abef);
+		state1 = _mm_add_epi32(state1, cdgh);
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1B);          /* FEBA */
+	state1 = _mm_shuffle_epi32(state1, 0xB1);       /* DCHG */
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);    /* DCBA */
+	state1 = _mm_alignr_epi8(state1, tmp, 8);       /* HGFE */
+	_mm_storeu_si128((__m128i *) &state[0], state0);
+	_mm_storeu_si128((__m128i *) &state[4], state1);
+}
+
+#define SHA256_LANES_NAME sha256_lanes_avx2
+#define SHA256_LANES_VEC sha256_vec8
+#define SHA256_LANES_N 8
+#define SHA256_LANES_TARGET "avx2"
+#include "sha256_lanes.h"
+#undef SHA256_LANES_NAME
+#undef SHA256_LANES_VEC
+#undef SHA256_LANES_N
+#undef SHA256_LANES_TARGET
+
+#define SHA256_LANES_NAME sha256_lanes_avx512
+#define SHA256_LANES_VEC sha256_vec16
+#define SHA256_LANES_N 16
+#define SHA256_LANES_TARGET "avx512f"
+#include "sha256_lanes.h"
+#undef SHA256_LANES_NAME
+#undef SHA256_LANES_VEC
+#undef SHA256_LANES_N
+#undef SHA256_LANES_TARGET
+#endif
+
+static sha256_blocks_fn sha256_blocks_impl = NULL;
+
+static sha256_blocks_fn sha256_blocks_select(void)
+{
+#ifdef NIMIQ_CPU_X86
+	const int required = NIMIQ_CPU_SHA | NIMIQ_CPU_SSE41 | NIMIQ_CPU_SSSE3;
+	if ((nimiq_cpu_features() & required) == required)
+		return sha256_blocks_shani;
+#endif
+	return sha256_blocks_ref;
+}
+
+// Transforms consecutive 64 byte blocks into the given state.
+void sha256_transform_blocks(WORD32 state[8], const BYTE data[], size_t blocks)
+{
+	if (sha256_blocks_impl == NULL)
+		sha256_blocks_impl = sha256_blocks_select();
+	sha256_blocks_impl(state, data, blocks);
+}
+
+void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+{
+	sha256_transform_blocks(ctx->state, data, 1);
 }
 
 void sha256_init(SHA256_CTX *ctx)
 {
 	ctx->datalen = 0;
 	ctx->bitlen = 0;
-	ctx->state[0] = 0x6a09e667;
-	ctx->state[1] = 0xbb67ae85;
-	ctx->state[2] = 0x3c6ef372;
-	ctx->state[3] = 0xa54ff53a;
-	ctx->state[4] = 0x510e527f;
-	ctx->state[5] = 0x9b05688c;
-	ctx->state[6] = 0x1f83d9ab;
-	ctx->state[7] = 0x5be0cd19;
+	memcpy(ctx->state, sha256_iv, sizeof(ctx->state));
 }
 
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len)
 {
-	WORD32 i;
+	size_t n;
 
-	for (i = 0; i < len; ++i) {
-		ctx->data[ctx->datalen] = data[i];
-		ctx->datalen++;
-		if (ctx->datalen == 64) {
-			sha256_transform(ctx, ctx->data);
-			ctx->bitlen += 512;
-			ctx->datalen = 0;
+	// Top up a partially filled buffer first.
+	if (ctx->datalen > 0) {
+		n = 64 - ctx->datalen;
+		if (len < n) {
+			memcpy(ctx->data + ctx->datalen, data, len);
+			ctx->datalen += len;
+			return;
 		}
+		memcpy(ctx->data + ctx->datalen, data, n);
+		sha256_transform(ctx, ctx->data);
+		ctx->bitlen += 512;
+		ctx->datalen = 0;
+		data += n;
+		len -= n;
+	}
+
+	// Transform full blocks straight from the input.
+	n = len / 64;
+	if (n > 0) {
+		sha256_transform_blocks(ctx->state, data, n);
+		ctx->bitlen += 512 * (unsigned long long)n;
+		data += 64 * n;
+		len -= 64 * n;
+	}
+
+	// Keep the remainder for the next update or final.
+	if (len > 0) {
+		memcpy(ctx->data, data, len);
+		ctx->datalen = len;
 	}
 }
 
@@ -156,3 +293,153 @@ void sha256_final(SHA256_CTX *ctx, BYTE hash[])
 		hash[i + 28] = (ctx->state[7] >> (24 - i * 8)) & 0x000000ff;
 	}
 }
+
+#ifdef NIMIQ_CPU_X86
+static void sha256_digest(BYTE hash[], const WORD32 state[8])
+{
+	WORD32 i;
+
+	for (i = 0; i < 8; ++i) {
+		hash[4 * i]     = state[i] >> 24;
+		hash[4 * i + 1] = state[i] >> 16;
+		hash[4 * i + 2] = state[i] >> 8;
+		hash[4 * i + 3] = state[i];
+	}
+}
+
+static void sha256_lane_init(SHA256_LANE *lane, const BYTE data[], size_t len, BYTE *out)
+{
+	size_t rem = len % 64;
+	unsigned long long bitlen = (unsigned long long)len * 8;
+	WORD32 i;
+
+	lane->data = data;
+	lane->blocks = len / 64;
+	lane->tail_next = lane->tail;
+	lane->tail_blocks = rem < 56 ? 1 : 2;
+	lane->out = out;
+	memset(lane->tail, 0, sizeof(lane->tail));
+	memcpy(lane->tail, data + len - rem, rem);
+	lane->tail[rem] = 0x80;
+	for (i = 0; i < 8; ++i)
+		lane->tail[64 * lane->tail_blocks - 1 - i] = bitlen >> (8 * i);
+}
+
+// Next block of the lane's padded message, NULL once it is done.
+static const BYTE *sha256_lane_next(SHA256_LANE *lane)
+{
+	const BYTE *block = NULL;
+
+	if (lane->blocks > 0) {
+		block = lane->data;
+		lane->data += 64;
+		lane->blocks--;
+	}
+	else if (lane->tail_blocks > 0) {
+		block = lane->tail_next;
+		lane->tail_next += 64;
+		lane->tail_blocks--;
+	}
+	return block;
+}
+
+/*
+ * Hashes count messages with a multi-buffer kernel of the given width.
+ * A lane picks up the next message as soon as its current one is done.
+ * Once the queue is empty and less than half of the lanes are busy, the
+ * remaining messages are finished one by one.
+ */
+static void sha256_multi_lanes(sha256_lanes_fn lanes_fn, int width, BYTE out[], const BYTE in[], const WORD32 inlens[], size_t count)
+{
+	static const BYTE idle[64] = {0};
+	WORD32 state[8][SHA256_MAX_LANES];
+	WORD32 single[8];
+	SHA256_LANE lane[SHA256_MAX_LANES];
+	const BYTE *blocks[SHA256_MAX_LANES];
+	int active[SHA256_MAX_LANES];
+	size_t next = 0;
+	int busy = 0, i, j;
+	const BYTE *block;
+
+	for (j = 0; j < width; ++j)
+		active[j] = 0;
+
+	for (;;) {
+		for (j = 0; j < width && next < count; ++j) {
+			if (active[j])
+				continue;
+			sha256_lane_init(&lane[j], in, inlens[next], out + 32 * next);
+			in += inlens[next];
+			next++;
+			for (i = 0; i < 8; ++i)
+				state[i][j] = sha256_iv[i];
+			active[j] = 1;
+			busy++;
+		}
+
+		if (next == count && 2 * busy < width)
+			break;
+
+		for (j = 0; j < width; ++j) {
+			blocks[j] = active[j] ? sha256_lane_next(&lane[j]) : idle;
+		}
+		lanes_fn(state, blocks);
+
+		for (j = 0; j < width; ++j) {
+			if (active[j] && lane[j].blocks == 0 && lane[j].tail_blocks == 0) {
+				for (i = 0; i < 8; ++i)
+					single[i] = state[i][j];
+				sha256_digest(lane[j].out, single);
+				active[j] = 0;
+				busy--;
+			}
+		}
+	}
+
+	for (j = 0; j < width; ++j) {
+		if (!active[j])
+			continue;
+		for (i = 0; i < 8; ++i)
+			single[i] = state[i][j];
+		while ((block = sha256_lane_next(&lane[j])) != NULL)
+			sha256_transform_blocks(single, block, 1);
+		sha256_digest(lane[j].out, single);
+	}
+}
+
+#endif
+
+static void sha256_serial(BYTE out[], const BYTE in[], const WORD32 inlens[], size_t count)
+{
+	SHA256_CTX ctx;
+	size_t i;
+
+	for (i = 0; i < count; ++i) {
+		sha256_init(&ctx);
+		sha256_update(&ctx, in, inlens[i]);
+		sha256_final(&ctx, out + 32 * i);
+		in += inlens[i];
+	}
+}
+
+/*
+ * Hashes count independent messages, stored back to back in in, with the
+ * lengths given by inlens. Writes count 32 byte digests to out.
+ */
+void sha256_multi(BYTE out[], const BYTE in[], const WORD32 inlens[], size_t count)
+{
+#ifdef NIMIQ_CPU_X86
+	int features = nimiq_cpu_features();
+
+	/* With SHA extensions, serial hashing beats everything but 16 full lanes */
+	if ((features & NIMIQ_CPU_AVX512F) && count >= ((features & NIMIQ_CPU_SHA) ? 16 : 8)) {
+		sha256_multi_lanes(sha256_lanes_avx512, 16, out, in, inlens, count);
+		return;
+	}
+	if ((features & NIMIQ_CPU_AVX2) && !(features & NIMIQ_CPU_SHA) && count >= 4) {
+		sha256_multi_lanes(sha256_lanes_avx2, 8, out, in, inlens, count);
+		return;
+	}
+#endif
+	sha256_serial(out, in, inlens, count);
+}
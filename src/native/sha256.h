@@ -28,7 +28,10 @@ typedef struct {
 
 /*********************** FUNCTION DECLARATIONS **********************/
 void sha256_init(SHA256_CTX *ctx);
+void sha256_transform(SHA256_CTX *ctx, const BYTE data[]);
+void sha256_transform_blocks(WORD32 state[8], const BYTE data[], size_t blocks);
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len);
 void sha256_final(SHA256_CTX *ctx, BYTE hash[]);
+void sha256_multi(BYTE out[], const BYTE in[], const WORD32 inlens[], size_t count);
 
 #endif   // SHA256_H
@@ -0,0 +1,60 @@
+/*
+ * Multi-buffer SHA-256 compression, included by sha256.c once per vector width.
+ * Needs SHA256_LANES_NAME, SHA256_LANES_VEC, SHA256_LANES_N and SHA256_LANES_TARGET.
+ *
+ * Compresses one 64 byte block into each of SHA256_LANES_N independent states,
+ * one state per vector lane. state[i][j] holds word i of lane j.
+ */
+
+typedef WORD32 SHA256_LANES_VEC __attribute__((vector_size(4 * SHA256_LANES_N)));
+
+__attribute__((target(SHA256_LANES_TARGET)))
+static void SHA256_LANES_NAME(WORD32 state[8][SHA256_MAX_LANES], const BYTE *const blocks[])
+{
+	SHA256_LANES_VEC a, b, c, d, e, f, g, h, t1, t2, m[16], s[8];
+	WORD32 words[SHA256_LANES_N];
+	int i, j;
+
+	for (i = 0; i < 16; ++i) {
+		for (j = 0; j < SHA256_LANES_N; ++j)
+			words[j] = ((WORD32)blocks[j][4 * i] << 24) | (blocks[j][4 * i + 1] << 16) | (blocks[j][4 * i + 2] << 8) | (blocks[j][4 * i + 3]);
+		memcpy(&m[i], words, sizeof(m[i]));
+	}
+	for (i = 0; i < 8; ++i)
+		memcpy(&s[i], state[i], sizeof(s[i]));
+
+	a = s[0];
+	b = s[1];
+	c = s[2];
+	d = s[3];
+	e = s[4];
+	f = s[5];
+	g = s[6];
+	h = s[7];
+
+	for (i = 0; i < 64; ++i) {
+		if (i >= 16)
+			m[i & 15] = SIG1(m[(i - 2) & 15]) + m[(i - 7) & 15] + SIG0(m[(i - 15) & 15]) + m[i & 15];
+		t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i & 15];
+		t2 = EP0(a) + MAJ(a,b,c);
+		h = g;
+		g = f;
+		f = e;
+		e = d + t1;
+		d = c;
+		c = b;
+		b = a;
+		a = t1 + t2;
+	}
+
+	s[0] += a;
+	s[1] += b;
+	s[2] += c;
+	s[3] += d;
+	s[4] += e;
+	s[5] += f;
+	s[6] += g;
+	s[7] += h;
+	for (i = 0; i < 8; ++i)
+		memcpy(state[i], &s[i], sizeof(s[i]));
+}
@@ -0,0 +1,87 @@
+#include <string.h>
+
+#include "slip10.h"
+#include "hmac_sha512.h"
+#include "nimiq_native.h"
+
+static const unsigned char slip10_curve[] = "ed25519 seed";
+
+void slip10_master_key(unsigned char *extended_key, const unsigned char *seed, size_t seedlen) {
+    hmac_sha512_context ctx;
+    hmac_sha512_init(&ctx, slip10_curve, sizeof(slip10_curve) - 1);
+    hmac_sha512(&ctx, seed, seedlen, extended_key);
+}
+
+/* child = HMAC-SHA512(chain code, 0x00 || private key || index with the hardened bit set) */
+static void slip10_derive_keyed(unsigned char *extended_key, const hmac_sha512_context *chain_code, const unsigned char *private_key, uint32_t index) {
+    unsigned char data[1 + SLIP10_PRIVATE_KEY_SIZE + 4];
+
+    index |= SLIP10_HARDENED;
+    data[0] = 0;
+    memcpy(data + 1, private_key, SLIP10_PRIVATE_KEY_SIZE);
+    data[33] = (unsigned char) (index >> 24);
+    data[34] = (unsigned char) (index >> 16);
+    data[35] = (unsigned char) (index >> 8);
+    data[36] = (unsigned char) index;
+
+    hmac_sha512(chain_code, data, sizeof(data), extended_key);
+}
+
+void slip10_derive(unsigned char *extended_key, const unsigned char *parent, uint32_t index) {
+    hmac_sha512_context ctx;
+    hmac_sha512_init(&ctx, parent + SLIP10_PRIVATE_KEY_SIZE, SLIP10_CHAIN_CODE_SIZE);
+    slip10_derive_keyed(extended_key, &ctx, parent, index);
+}
+
+void slip10_derive_path(unsigned char *extended_key, const unsigned char *parent, const uint32_t *path, size_t depth) {
+    unsigned char key[SLIP10_EXTENDED_KEY_SIZE];
+    size_t i;
+
+    memcpy(key, parent, sizeof(key));
+    for (i = 0; i < depth; ++i) {
+        slip10_derive(key, key, path[i]);
+    }
+    memcpy(extended_key, key, sizeof(key));
+}
+
+/*
+ * Derives parent/path for count consecutive values of path[variable_level],
+ * starting at first_index. The levels before the variable one are derived
+ * only once, and the HMAC pad states of their chain code are shared by all
+ * children. Any of private_keys, public_keys (for which the key pair is
+ * computed) and addresses (the first 20 bytes of the Blake2b hash of the
+ * public key) may be NULL. The public keys of SLIP10_RANGE_BATCH children
+ * at a time are derived together with nimiq_public_keys_derive.
+ */
+void slip10_derive_range(unsigned char *private_keys, unsigned char *public_keys, unsigned char *addresses,
+                         const unsigned char *parent, const uint32_t *path, size_t depth, size_t variable_level,
+                         uint32_t first_index, size_t count) {
+    hmac_sha512_context ctx;
+    unsigned char prefix[SLIP10_EXTENDED_KEY_SIZE];
+    unsigned char key[SLIP10_EXTENDED_KEY_SIZE];
+    unsigned char keys[SLIP10_RANGE_BATCH * SLIP10_PRIVATE_KEY_SIZE];
+    size_t start;
+    size_t chunk;
+    size_t i;
+
+    slip10_derive_path(prefix, parent, path, variable_level);
+    hmac_sha512_init(&ctx, prefix + SLIP10_PRIVATE_KEY_SIZE, SLIP10_CHAIN_CODE_SIZE);
+
+    for (start = 0; start < count; start += chunk) {
+        chunk = count - start < SLIP10_RANGE_BATCH ? count - start : SLIP10_RANGE_BATCH;
+
+        for (i = 0; i < chunk; ++i) {
+            slip10_derive_keyed(key, &ctx, prefix, first_index + (uint32_t) (start + i));
+            slip10_derive_path(key, key, path + variable_level + 1, depth - variable_level - 1);
+            memcpy(keys + i * SLIP10_PRIVATE_KEY_SIZE, key, SLIP10_PRIVATE_KEY_SIZE);
+        }
+
+        if (private_keys) {
+            memcpy(private_keys + start * SLIP10_PRIVATE_KEY_SIZE, keys, chunk * SLIP10_PRIVATE_KEY_SIZE);
+        }
+        if (public_keys || addresses) {
+            nimiq_public_keys_derive(public_keys ? public_keys + start * SLIP10_PUBLIC_KEY_SIZE : NULL,
+                                     addresses ? addresses + start * SLIP10_ADDRESS_SIZE : NULL, keys, chunk);
+        }
+    }
+}
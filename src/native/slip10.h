@@ -0,0 +1,25 @@
+#ifndef __NIMIQ_SLIP10_H
+#define __NIMIQ_SLIP10_H
+
+#include <stddef.h>
+
+#include "ed25519/fixedint.h"
+
+/* SLIP-0010 hierarchical deterministic derivation of ed25519 keys */
+
+#define SLIP10_PRIVATE_KEY_SIZE 32
+#define SLIP10_CHAIN_CODE_SIZE 32
+#define SLIP10_EXTENDED_KEY_SIZE 64     /* private key || chain code */
+#define SLIP10_PUBLIC_KEY_SIZE 32
+#define SLIP10_ADDRESS_SIZE 20
+#define SLIP10_HARDENED 0x80000000u     /* ed25519 only supports hardened derivation */
+#define SLIP10_RANGE_BATCH 64           /* children per batch of slip10_derive_range */
+
+void slip10_master_key(unsigned char *extended_key, const unsigned char *seed, size_t seedlen);
+void slip10_derive(unsigned char *extended_key, const unsigned char *parent, uint32_t index);
+void slip10_derive_path(unsigned char *extended_key, const unsigned char *parent, const uint32_t *path, size_t depth);
+void slip10_derive_range(unsigned char *private_keys, unsigned char *public_keys, unsigned char *addresses,
+                         const unsigned char *parent, const uint32_t *path, size_t depth, size_t variable_level,
+                         uint32_t first_index, size_t count);
+
+#endif
@@ -0,0 +1,85 @@
+#include <string.h>
+
+#include "vanity.h"
+#include "blake2/blake2.h"
+#include "ed25519/sha512.h"
+#include "ed25519/ge.h"
+
+/* 5 bit group i of a 20 byte address, i.e. the value of its i-th base32 character */
+static unsigned int vanity_group(const unsigned char *address, size_t i) {
+    size_t bit = 5 * i;
+    unsigned int window = address[bit / 8] << 8;
+    if (bit / 8 + 1 < 20) window |= address[bit / 8 + 1];
+    return (window >> (11 - bit % 8)) & 31;
+}
+
+static int vanity_matches(const unsigned char *address, const unsigned char *pattern, size_t pattern_len, int mode) {
+    size_t offset = mode == VANITY_MATCH_SUFFIX ? VANITY_ADDRESS_CHARS - pattern_len : 0;
+    size_t i;
+    for (i = 0; i < pattern_len; ++i) {
+        if (vanity_group(address, offset + i) != pattern[i]) return 0;
+    }
+    return 1;
+}
+
+/*
+ * Tests the candidates first_candidate ... first_candidate + candidates - 1.
+ * The private key of candidate i is the Blake2b hash of i keyed with key, so a
+ * search can be split into ranges and only the key needs to be random.
+ * pattern holds base32 character values (0 - 31), mode selects whether they
+ * have to match the start or the end of the address. Stores the private keys
+ * of up to max_matches matches and returns the number of matches found.
+ *
+ * Keys are processed in batches: SHA-512 expansion runs on the multi-buffer
+ * kernels and the public keys share a single field inversion.
+ */
+size_t vanity_search(unsigned char *matches, size_t max_matches, const unsigned char *key, uint32_t first_candidate,
+                     size_t candidates, const unsigned char *pattern, size_t pattern_len, int mode) {
+    unsigned char seeds[VANITY_BATCH_SIZE * VANITY_SEED_SIZE];
+    unsigned char az[VANITY_BATCH_SIZE * 64];
+    unsigned char public_keys[VANITY_BATCH_SIZE * 32];
+    uint32_t seed_lens[VANITY_BATCH_SIZE];
+    ge_p3 points[VANITY_BATCH_SIZE];
+    unsigned char counter[4];
+    unsigned char hash[32];
+    size_t found = 0;
+    size_t batch;
+    size_t i;
+
+    if (pattern_len > VANITY_ADDRESS_CHARS) return 0;
+
+    for ( ; candidates > 0; candidates -= batch, first_candidate += batch) {
+        batch = candidates < VANITY_BATCH_SIZE ? candidates : VANITY_BATCH_SIZE;
+
+        for (i = 0; i < batch; ++i) {
+            uint32_t n = first_candidate + (uint32_t) i;
+            counter[0] = (unsigned char) n;
+            counter[1] = (unsigned char) (n >> 8);
+            counter[2] = (unsigned char) (n >> 16);
+            counter[3] = (unsigned char) (n >> 24);
+            blake2b(seeds + i * VANITY_SEED_SIZE, VANITY_SEED_SIZE, counter, sizeof(counter), key, VANITY_KEY_SIZE);
+            seed_lens[i] = VANITY_SEED_SIZE;
+        }
+
+        /* expand the private keys as in ed25519_private_key_decompress */
+        sha512_multi(az, seeds, seed_lens, batch);
+        for (i = 0; i < batch; ++i) {
+            unsigned char *a = az + 64 * i;
+            a[0] &= 248;
+            a[31] &= 63;
+            a[31] |= 64;
+            ge_scalarmult_base(&points[i], a);
+        }
+        ge_p3_batch_tobytes(public_keys, points, batch);
+
+        for (i = 0; i < batch; ++i) {
+            blake2b(hash, sizeof(hash), public_keys + 32 * i, 32, NULL, 0);
+            if (!vanity_matches(hash, pattern, pattern_len, mode)) continue;
+            if (found < max_matches) {
+                memcpy(matches + found * VANITY_SEED_SIZE, seeds + i * VANITY_SEED_SIZE, VANITY_SEED_SIZE);
+            }
+            found++;
+        }
+    }
+    return found;
+}
@@ -0,0 +1,21 @@
+#ifndef __NIMIQ_VANITY_H
+#define __NIMIQ_VANITY_H
+
+#include <stddef.h>
+
+#include "ed25519/fixedint.h"
+
+/* Search for addresses whose base32 form starts or ends with a given pattern */
+
+#define VANITY_KEY_SIZE 32          /* secret key of the candidate generator */
+#define VANITY_SEED_SIZE 32         /* private key of a match */
+#define VANITY_ADDRESS_CHARS 32     /* base32 characters of a 20 byte address */
+#define VANITY_BATCH_SIZE 64        /* candidates processed together */
+
+#define VANITY_MATCH_PREFIX 0
+#define VANITY_MATCH_SUFFIX 1
+
+size_t vanity_search(unsigned char *matches, size_t max_matches, const unsigned char *key, uint32_t first_candidate,
+                     size_t candidates, const unsigned char *pattern, size_t pattern_len, int mode);
+
+#endif
@@ -34,6 +34,21 @@ describe('Commitment', () => {
         })().then(done, done.fail);
     });
 
+    it('rejects commitments that are not valid points', () => {
+        // Only the native code checks the commitments, the wasm build does not yet.
+        if (!PlatformUtils.isNodeJs()) return;
+
+        const commitment1 = new Commitment(BufferUtils.fromBase64('K38BsHxjOe06cgAW5000CjdQpNu6zQIzszvaeaHyij8='));
+        // y = 2 is not the y-coordinate of any point on the curve.
+        const invalid = new Uint8Array(Commitment.SIZE);
+        invalid[0] = 2;
+        const commitment2 = new Commitment(invalid);
+
+        expect(() => Commitment.sum([commitment1, commitment2])).toThrow();
+        expect(() => Commitment.sum([commitment2, commitment1])).toThrow();
+        expect(() => Commitment.sum([commitment2])).toThrow();
+    });
+
     it('correctly aggregates commitments', (done) => {
         (async function () {
             for (const testCase of Dummy.partialSignatureTestVectors) {
@@ -42,4 +57,20 @@ describe('Commitment', () => {
             }
         })().then(done, done.fail);
     });
+
+    it('generates many commitment pairs', () => {
+        const keyPair = KeyPair.generate();
+        const aggPublicKey = PublicKey.sum([keyPair.publicKey]);
+        const message = BufferUtils.fromAscii('message');
+        const pairs = CommitmentPair.generateMany(70);
+        expect(pairs.length).toBe(70);
+        expect(new Set(pairs.map(pair => pair.commitment.toBase64())).size).toBe(70);
+        for (const pair of pairs) {
+            // A signature only verifies if the commitment belongs to the secret.
+            const partialSignature = PartialSignature.create(keyPair.privateKey, keyPair.publicKey, [keyPair.publicKey],
+                pair.secret, pair.commitment, message);
+            const signature = Signature.fromPartialSignatures(pair.commitment, [partialSignature]);
+            expect(signature.verify(aggPublicKey, message)).toBe(true);
+        }
+    });
 });
@@ -103,4 +103,29 @@ describe('ExtendedPrivateKey', () => {
             }
         }
     });
+
+    it('derives index ranges of path templates', async () => {
+        const master = ExtendedPrivateKey.generateMasterKey(BufferUtils.fromHex('000102030405060708090a0b0c0d0e0f'));
+        const templates = [['m/44\'/242\'/0\'/i\'', i => `m/44'/242'/0'/${i}'`], ['m/0\'/i\'/2\'', i => `m/0'/${i}'/2'`]];
+
+        for (const [template, pathOf] of templates) {
+            const range = master.deriveRange(template, 3, 5);
+            const rangeAsync = await master.deriveRangeAsync(template, 3, 5, 2);
+            expect(range.privateKeys.length).toBe(5);
+            expect(rangeAsync.privateKeys.length).toBe(5);
+
+            for (let i = 0; i < 5; i++) {
+                const privateKey = master.derivePath(pathOf(3 + i)).privateKey;
+                const publicKey = PublicKey.derive(privateKey);
+                for (const result of [range, rangeAsync]) {
+                    expect(result.privateKeys[i].equals(privateKey)).toBe(true);
+                    expect(result.publicKeys[i].equals(publicKey)).toBe(true);
+                    expect(result.addresses[i].equals(publicKey.toAddress())).toBe(true);
+                }
+            }
+        }
+
+        expect(() => master.deriveRange('m/44\'/242\'/0\'', 0, 1)).toThrow();
+        expect(() => master.deriveRange('m/i\'/i\'', 0, 1)).toThrow();
+    });
 });
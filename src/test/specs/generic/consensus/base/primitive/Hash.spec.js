@@ -57,4 +57,32 @@ describe('Hash', () => {
         const hash = Hash.sha512(dataToHash);
         expect(BufferUtils.toHex(hash.serialize())).toBe(expectedHash);
     });
+
+    it('can compute hash chains', () => {
+        const preImage = Hash.sha256(BufferUtils.fromAscii(Dummy.shaHash.input));
+        let expected = preImage;
+        for (let i = 0; i < 5; i++) {
+            expected = Hash.compute(expected.array, Hash.Algorithm.SHA256);
+        }
+        expect(Hash.compute(preImage.array, Hash.Algorithm.SHA256, 5).equals(expected)).toBe(true);
+
+        const preImage512 = Hash.sha512(BufferUtils.fromAscii(Dummy.shaHash.input));
+        let expected512 = preImage512.array;
+        for (let i = 0; i < 3; i++) {
+            expected512 = Hash.computeSha512(expected512);
+        }
+        expect(BufferUtils.equals(Hash.computeChain(preImage512.array, Hash.Algorithm.SHA512, 3), expected512)).toBe(true);
+        expect(BufferUtils.equals(Hash.computeChain(preImage512.array, Hash.Algorithm.SHA512, 0), preImage512.array)).toBe(true);
+
+        expect(() => Hash.compute(preImage512.array, Hash.Algorithm.SHA512, 3)).toThrow();
+        expect(() => Hash.compute(preImage.array, Hash.Algorithm.SHA256, 256)).toThrow();
+    });
+
+    it('can compute hash chains asynchronously', (done) => {
+        (async () => {
+            const preImage = Hash.blake2b(BufferUtils.fromAscii('hello'));
+            const chain = await Hash.computeChainAsync(preImage.array, Hash.Algorithm.BLAKE2B, 7);
+            expect(BufferUtils.equals(chain, Hash.computeChain(preImage.array, Hash.Algorithm.BLAKE2B, 7))).toBe(true);
+        })().then(done, done.fail);
+    });
 });
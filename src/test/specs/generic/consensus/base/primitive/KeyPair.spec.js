@@ -9,6 +9,38 @@ describe('KeyPair', () => {
         expect(pair1.isLocked).toEqual(pair2.isLocked);
     });
 
+    it('can generate many key pairs into contiguous buffers', (done) => {
+        (async () => {
+            const count = 70;
+            const check = (privateKeys, publicKeys, addresses) => {
+                const seen = new Set();
+                for (let i = 0; i < count; i++) {
+                    const privateKey = new PrivateKey(privateKeys.slice(i * PrivateKey.SIZE, (i + 1) * PrivateKey.SIZE));
+                    const publicKey = PublicKey.derive(privateKey);
+                    if (publicKeys) expect(publicKeys.subarray(i * PublicKey.SIZE, (i + 1) * PublicKey.SIZE)).toEqual(publicKey.serialize());
+                    expect(addresses.subarray(i * Address.SERIALIZED_SIZE, (i + 1) * Address.SERIALIZED_SIZE)).toEqual(publicKey.toAddress().serialize());
+                    seen.add(privateKey.toHex());
+                }
+                expect(seen.size).toBe(count);
+            };
+
+            let privateKeys = new Uint8Array(count * PrivateKey.SIZE);
+            let publicKeys = new Uint8Array(count * PublicKey.SIZE);
+            let addresses = new Uint8Array(count * Address.SERIALIZED_SIZE);
+            KeyPair.generateMany(privateKeys, publicKeys, addresses);
+            check(privateKeys, publicKeys, addresses);
+
+            // Views at an offset and missing public keys
+            privateKeys = new Uint8Array(count * PrivateKey.SIZE + 3).subarray(3);
+            addresses = new Uint8Array(count * Address.SERIALIZED_SIZE + 5).subarray(5);
+            await KeyPair.generateManyAsync(privateKeys, null, addresses, 3);
+            check(privateKeys, null, addresses);
+
+            expect(() => KeyPair.generateMany(new Uint8Array(PrivateKey.SIZE + 1))).toThrow();
+            expect(() => KeyPair.generateMany(new Uint8Array(2 * PrivateKey.SIZE), new Uint8Array(PublicKey.SIZE))).toThrow();
+        })().then(done, done.fail);
+    });
+
     it('can encrypt and decrypt after locked serialization', (done) => {
         (async () => {
             const key = new Uint8Array([1, 2, 3, 4]);
@@ -0,0 +1,92 @@
+describe('MultiSigContext', () => {
+
+    it('creates the partial signatures of the test vectors', (done) => {
+        (async function () {
+            for (const testCase of Dummy.partialSignatureTestVectors) {
+                const publicKeys = testCase.pubKeys.map(k => new PublicKey(k));
+                // The context sorts the public keys, so only test vectors with sorted keys apply.
+                if (publicKeys.some((k, i) => i > 0 && publicKeys[i - 1].compare(k) > 0)) continue;
+
+                for (let i = 0; i < publicKeys.length; ++i) {
+                    const context = new MultiSigContext(publicKeys, new PrivateKey(testCase.privKeys[i]), publicKeys[i]);
+                    expect(BufferUtils.equals(context.aggregatePublicKey.serialize(), testCase.aggPubKey)).toBe(true);
+
+                    const partialSignature = context.partialSign(new RandomSecret(testCase.secrets[i]),
+                        new Commitment(testCase.aggCommitment), testCase.message);
+                    expect(BufferUtils.equals(partialSignature.serialize(), testCase.partialSignatures[i])).toBe(true);
+                }
+            }
+        })().then(done, done.fail);
+    });
+
+    it('creates valid multisignatures for many messages', (done) => {
+        (async function () {
+            const keyPairs = [];
+            for (let i = 0; i < 3; ++i) keyPairs.push(KeyPair.generate());
+            const publicKeys = keyPairs.map(keyPair => keyPair.publicKey);
+            const contexts = keyPairs.map(keyPair => new MultiSigContext(publicKeys, keyPair.privateKey, keyPair.publicKey));
+            const verifier = new MultiSigContext(publicKeys.slice().reverse());
+            expect(verifier.aggregatePublicKey.equals(PublicKey.sum(publicKeys))).toBe(true);
+            expect(() => verifier.partialSign(null, null, new Uint8Array(0))).toThrow();
+
+            for (let m = 0; m < 5; ++m) {
+                const message = BufferUtils.fromAscii(`message ${m}`);
+                const nonces = keyPairs.map(() => CommitmentPair.generate());
+                const aggCommitment = Commitment.sum(nonces.map(nonce => nonce.commitment));
+                const partialSignatures = contexts.map((context, i) => context.partialSign(nonces[i].secret, aggCommitment, message));
+                for (let i = 0; i < 3; ++i) {
+                    const expected = PartialSignature.create(keyPairs[i].privateKey, keyPairs[i].publicKey,
+                        verifier.publicKeys, nonces[i].secret, aggCommitment, message);
+                    expect(partialSignatures[i].equals(expected)).toBe(true);
+                }
+                const signature = Signature.fromPartialSignatures(aggCommitment, partialSignatures);
+                expect(signature.verify(verifier.aggregatePublicKey, message)).toBe(true);
+            }
+        })().then(done, done.fail);
+    });
+
+    it('verifies partial signatures', (done) => {
+        (async function () {
+            if (!PlatformUtils.isNodeJs()) return;
+
+            const keyPairs = [];
+            for (let i = 0; i < 4; ++i) keyPairs.push(KeyPair.generate());
+            const verifier = new MultiSigContext(keyPairs.map(keyPair => keyPair.publicKey));
+            const message = BufferUtils.fromAscii('message');
+            const nonces = verifier.publicKeys.map(() => CommitmentPair.generate());
+            const commitments = nonces.map(nonce => nonce.commitment);
+            const aggCommitment = Commitment.sum(commitments);
+            const partialSignatures = verifier.publicKeys.map((publicKey, i) => {
+                const keyPair = keyPairs.find(k => k.publicKey.equals(publicKey));
+                return PartialSignature.create(keyPair.privateKey, publicKey, verifier.publicKeys, nonces[i].secret,
+                    aggCommitment, message);
+            });
+
+            for (let i = 0; i < 4; ++i) {
+                expect(verifier.verifyPartialSignature(verifier.publicKeys[i], partialSignatures[i], commitments[i], aggCommitment, message)).toBe(true);
+                expect(verifier.verifyPartialSignature(verifier.publicKeys[i], partialSignatures[i], commitments[(i + 1) % 4], aggCommitment, message)).toBe(false);
+            }
+            expect(verifier.verifyPartialSignatures(partialSignatures, commitments, aggCommitment, message)).toEqual([true, true, true, true]);
+
+            const swapped = partialSignatures.slice();
+            swapped[1] = partialSignatures[2];
+            swapped[2] = partialSignatures[1];
+            expect(verifier.verifyPartialSignatures(swapped, commitments, aggCommitment, message)).toEqual([true, false, false, true]);
+            expect(verifier.verifyPartialSignatures(partialSignatures, commitments, aggCommitment, BufferUtils.fromAscii('other'))).toEqual([false, false, false, false]);
+        })().then(done, done.fail);
+    });
+
+    it('rejects public keys that are not valid points', () => {
+        // Only the native code checks the keys, the wasm build does not yet.
+        if (!PlatformUtils.isNodeJs()) return;
+
+        const keyPair = KeyPair.generate();
+        // y = 2 is not the y-coordinate of any point on the curve.
+        const invalid = new Uint8Array(PublicKey.SIZE);
+        invalid[0] = 2;
+        const publicKeys = [keyPair.publicKey, new PublicKey(invalid)];
+
+        expect(() => new MultiSigContext(publicKeys)).toThrow();
+        expect(() => new MultiSigContext(publicKeys, keyPair.privateKey, keyPair.publicKey)).toThrow();
+    });
+});
@@ -30,6 +30,23 @@ describe('PublicKey', () => {
         expect(PublicKey.sum([pubKey2, pubKey1]).equals(pubKey3)).toEqual(true);
     });
 
+    it('rejects public keys that are not valid points', () => {
+        // Only the native code checks the keys, the wasm build does not yet.
+        if (!PlatformUtils.isNodeJs()) return;
+
+        const pubKey1 = PublicKey.unserialize(BufferUtils.fromBase64(Dummy.publicKey1));
+        // y = 2 is not the y-coordinate of any point on the curve.
+        const invalid = new Uint8Array(PublicKey.SIZE);
+        invalid[0] = 2;
+        const pubKey2 = new PublicKey(invalid);
+        const publicKeysHash = PublicKey._publicKeysHash([pubKey1.serialize(), invalid]);
+
+        expect(() => PublicKey._publicKeyDelinearize(invalid, publicKeysHash)).toThrow();
+        expect(() => PublicKey._publicKeysDelinearizeAndAggregate([pubKey1.serialize(), invalid], publicKeysHash)).toThrow();
+        expect(() => PublicKey.sum([pubKey1, pubKey2])).toThrow();
+        expect(() => PublicKey.sum([pubKey2, pubKey1])).toThrow();
+    });
+
     it('correctly derives the public key', (done) => {
         (async function () {
             for (const testCase of Dummy.partialSignatureTestVectors) {
@@ -76,4 +93,42 @@ describe('PublicKey', () => {
             }
         })().then(done, done.fail);
     });
+
+    it('reports statistics of the decompressed key cache', () => {
+        const keyPair = KeyPair.generate();
+        const data1 = BufferUtils.fromAscii('cached key');
+        const data2 = BufferUtils.fromAscii('cached key again');
+        const signature1 = Signature.create(keyPair.privateKey, keyPair.publicKey, data1);
+        const signature2 = Signature.create(keyPair.privateKey, keyPair.publicKey, data2);
+
+        const before = PublicKey.getCacheStats();
+        expect(signature1.verify(keyPair.publicKey, data1)).toBe(true);
+        expect(signature2.verify(keyPair.publicKey, data2)).toBe(true);
+        const after = PublicKey.getCacheStats();
+
+        if (PlatformUtils.isNodeJs()) {
+            expect(after.hits + after.misses).toBe(before.hits + before.misses + 2);
+            expect(after.hits).toBeGreaterThan(before.hits);
+        } else {
+            expect(after).toEqual({hits: 0, misses: 0});
+        }
+    });
+
+    it('derives many public keys and addresses', (done) => {
+        (async function () {
+            const privateKeys = [];
+            for (let i = 0; i < 70; i++) privateKeys.push(PrivateKey.generate());
+
+            const publicKeys = PublicKey.deriveMany(privateKeys);
+            const addresses = await PublicKey.deriveAddressesAsync(privateKeys, 3);
+            expect(publicKeys.length).toBe(70);
+            expect(addresses.length).toBe(70);
+            for (let i = 0; i < 70; i++) {
+                const publicKey = PublicKey.derive(privateKeys[i]);
+                expect(publicKeys[i].equals(publicKey)).toBe(true);
+                expect(addresses[i].equals(publicKey.toAddress())).toBe(true);
+            }
+            expect(PublicKey.deriveMany([])).toEqual([]);
+        })().then(done, done.fail);
+    });
 });
@@ -203,6 +203,61 @@ describe('Signature', () => {
         })().then(done, done.fail);
     });
 
+    it('can verify signatures in batches', (done) => {
+        (async function () {
+            const signatures = [], publicKeys = [], data = [];
+            for (let i = 0; i < 70; ++i) {
+                const keyPair = KeyPair.generate();
+                const message = BufferUtils.fromAscii(`message ${i}`);
+                signatures.push(Signature.create(keyPair.privateKey, keyPair.publicKey, message));
+                publicKeys.push(keyPair.publicKey);
+                data.push(message);
+            }
+            expect(Signature.verifyBatch(signatures, publicKeys, data).every(valid => valid)).toBe(true);
+            expect(Signature.verifyBatch([], [], [])).toEqual([]);
+
+            data[3] = BufferUtils.fromAscii('wrong message');
+            publicKeys[40] = publicKeys[41];
+            const tampered = new Uint8Array(signatures[65].serialize());
+            tampered[40] ^= 1;
+            signatures[65] = new Signature(tampered);
+
+            const valid = Signature.verifyBatch(signatures, publicKeys, data);
+            const validMany = await Signature.verifyManyAsync(signatures, publicKeys, data, 3);
+            for (let i = 0; i < 70; ++i) {
+                expect(valid[i]).toBe(signatures[i].verify(publicKeys[i], data[i]));
+                expect(valid[i]).toBe(i !== 3 && i !== 40 && i !== 65);
+                expect(validMany[i]).toBe(valid[i]);
+            }
+        })().then(done, done.fail);
+    });
+
+    it('caches verified signatures only', (done) => {
+        (async function () {
+            const keyPair = KeyPair.generate();
+            const data = BufferUtils.fromAscii('cached signature');
+            const signature = Signature.create(keyPair.privateKey, keyPair.publicKey, data);
+            const tampered = new Uint8Array(signature.serialize());
+            tampered[40] ^= 1;
+            const wrongSignature = new Signature(tampered);
+
+            const before = Signature.getCacheStats();
+            expect(wrongSignature.verify(keyPair.publicKey, data)).toBe(false);
+            expect(wrongSignature.verify(keyPair.publicKey, data)).toBe(false);
+            expect(signature.verify(keyPair.publicKey, data)).toBe(true);
+            expect((await Signature.verifyManyAsync([signature, wrongSignature], [keyPair.publicKey, keyPair.publicKey], [data, data]))).toEqual([true, false]);
+            expect(Signature.verifyBatch([signature, wrongSignature], [keyPair.publicKey, keyPair.publicKey], [data, data])).toEqual([true, false]);
+            const after = Signature.getCacheStats();
+
+            if (PlatformUtils.isNodeJs()) {
+                expect(after.hits).toBe(before.hits + 2);
+                expect(after.misses).toBe(before.misses + 5);
+            } else {
+                expect(after).toEqual({hits: 0, misses: 0});
+            }
+        })().then(done, done.fail);
+    });
+
     it('correctly aggregates partial signatures', (done) => {
         (async function () {
             for (const testCase of Dummy.partialSignatureTestVectors) {
@@ -0,0 +1,32 @@
+describe('SigningKey', () => {
+
+    it('creates the same signatures as Signature.create', (done) => {
+        (async function () {
+            const keyPair = KeyPair.generate();
+            const signingKey = new SigningKey(keyPair.privateKey);
+            expect(signingKey.publicKey.equals(keyPair.publicKey)).toBe(true);
+
+            const data = [];
+            for (let i = 0; i < 70; ++i) {
+                const message = new Uint8Array(i * 3);
+                CryptoWorker.lib.getRandomValues(message);
+                data.push(message);
+            }
+
+            const signatures = signingKey.signMany(data);
+            const signaturesAsync = await signingKey.signManyAsync(data, 3);
+            expect(signatures.length).toBe(70);
+            expect(signaturesAsync.length).toBe(70);
+            for (let i = 0; i < 70; ++i) {
+                const expected = Signature.create(keyPair.privateKey, keyPair.publicKey, data[i]);
+                expect(signingKey.sign(data[i]).equals(expected)).toBe(true);
+                expect(signatures[i].equals(expected)).toBe(true);
+                expect(signaturesAsync[i].equals(expected)).toBe(true);
+                expect(signatures[i].verify(keyPair.publicKey, data[i])).toBe(true);
+            }
+
+            expect(signingKey.signMany([])).toEqual([]);
+            expect(await signingKey.signManyAsync([])).toEqual([]);
+        })().then(done, done.fail);
+    });
+});
@@ -0,0 +1,26 @@
+describe('VanityAddressSearch', () => {
+    it('finds addresses with a given prefix or suffix', async () => {
+        for (const [pattern, suffix] of [['A', false], ['x', true]]) {
+            const search = new VanityAddressSearch(pattern, suffix);
+            const matches = await search.find(2, 2);
+            expect(matches.length).toBe(2);
+            expect(search.candidates).toBeGreaterThan(0);
+
+            for (const keyPair of matches) {
+                const chars = keyPair.publicKey.toAddress().toUserFriendlyAddress(false).substr(4);
+                if (suffix) {
+                    expect(chars.endsWith(pattern.toUpperCase())).toBe(true);
+                } else {
+                    expect(chars.startsWith(pattern.toUpperCase())).toBe(true);
+                }
+                expect(search.matches(keyPair.publicKey.toAddress())).toBe(true);
+            }
+        }
+    });
+
+    it('rejects invalid patterns', () => {
+        expect(() => new VanityAddressSearch('')).toThrow();
+        expect(() => new VanityAddressSearch('NIMIQ')).toThrow();
+        expect(() => new VanityAddressSearch('0'.repeat(33))).toThrow();
+    });
+});
@@ -19,4 +19,149 @@ describe('SignatureProof', () => {
             expect(SignatureProof.unserialize(proof.serialize()).equals(proof)).toBe(true, `Serialization failed ${i}`);
         }
     });
+
+    it('can verify multisig proofs of transactions', (done) => {
+        (async function () {
+            const keyPair = KeyPair.generate();
+            const publicKeys = [keyPair.publicKey];
+            for (let i = 0; i < 6; ++i) {
+                publicKeys.push(KeyPair.generate().publicKey);
+            }
+            const sender = Address.fromHash(MerkleTree.computeRoot(publicKeys));
+            const recipient = KeyPair.generate().publicKey.toAddress();
+
+            const transactions = [];
+            for (let i = 0; i < 4; ++i) {
+                const tx = new ExtendedTransaction(sender, Account.Type.BASIC, recipient, Account.Type.BASIC, 1000 + i, 0, 1, Transaction.Flag.NONE, new Uint8Array(0));
+                const signature = Signature.create(keyPair.privateKey, keyPair.publicKey, tx.serializeContent());
+                tx.proof = SignatureProof.multiSig(keyPair.publicKey, publicKeys, signature).serialize();
+                transactions.push(tx);
+            }
+            // Leave the last cosigner out of the Merkle path of transaction 2.
+            const signature2 = SignatureProof.unserialize(new SerialBuffer(transactions[2].proof)).signature;
+            transactions[2].proof = SignatureProof.multiSig(keyPair.publicKey, publicKeys.slice(0, 6), signature2).serialize();
+
+            for (let i = 0; i < 4; ++i) {
+                expect(SignatureProof.verifyTransaction(transactions[i])).toBe(i !== 2);
+            }
+            await SignatureProof.verifyTransactionsAsync(transactions);
+            for (let i = 0; i < 4; ++i) {
+                expect(SignatureProof.verifyTransaction(transactions[i])).toBe(i !== 2);
+            }
+        })().then(done, done.fail);
+    });
+
+    it('can check the signatures of many transactions asynchronously', (done) => {
+        (async function () {
+            const transactions = [];
+            for (let i = 0; i < 10; ++i) {
+                const keyPair = KeyPair.generate();
+                const recipient = KeyPair.generate().publicKey.toAddress();
+                const tx = new BasicTransaction(keyPair.publicKey, recipient, 1000 + i, 0, 1);
+                tx.signature = Signature.create(keyPair.privateKey, keyPair.publicKey, tx.serializeContent());
+                transactions.push(tx);
+            }
+            // Sign transaction 4 with the wrong key.
+            const wrongKey = KeyPair.generate();
+            transactions[4].signature = Signature.create(wrongKey.privateKey, wrongKey.publicKey, transactions[4].serializeContent());
+
+            // Claim the sender of transaction 7 for another signer.
+            const proof7 = SignatureProof.unserialize(new SerialBuffer(transactions[7].proof));
+            transactions[7].proof = SignatureProof.singleSig(KeyPair.generate().publicKey, proof7.signature).serialize();
+            // Append a byte to the proof of transaction 8.
+            transactions[8].proof = BufferUtils.concatTypedArrays(transactions[8].proof, new Uint8Array(1));
+
+            await SignatureProof.verifyTransactionsAsync(transactions, 3);
+            for (let i = 0; i < 10; ++i) {
+                expect(transactions[i].verify()).toBe(i !== 4 && i !== 7 && i !== 8);
+            }
+
+            const valid = await Signature.verifyManyAsync([], [], []);
+            expect(valid).toEqual([]);
+        })().then(done, done.fail);
+    });
+
+    it('rejects proofs that are one byte too long or too short', (done) => {
+        (async function () {
+            const keyPair = KeyPair.generate();
+            const recipient = KeyPair.generate().publicKey.toAddress();
+            const transactions = [];
+            for (let i = 0; i < 2; ++i) {
+                const tx = new BasicTransaction(keyPair.publicKey, recipient, 1000 + i, 0, 1);
+                tx.signature = Signature.create(keyPair.privateKey, keyPair.publicKey, tx.serializeContent());
+                transactions.push(tx);
+            }
+            transactions[0].proof = BufferUtils.concatTypedArrays(transactions[0].proof, new Uint8Array(1));
+            transactions[1].proof = transactions[1].proof.slice(0, transactions[1].proof.length - 1);
+
+            spyOn(Log, 'w');
+            for (const tx of transactions) {
+                expect(SignatureProof.verifyTransaction(tx)).toBe(false);
+            }
+            await SignatureProof.verifyTransactionsAsync(transactions);
+            for (const tx of transactions) {
+                expect(SignatureProof.verifyTransaction(tx)).toBe(false);
+            }
+            if (PlatformUtils.isNodeJs()) {
+                expect(Log.w).toHaveBeenCalledWith(SignatureProof, 'Invalid SignatureProof - malformed');
+                expect(Log.w).not.toHaveBeenCalledWith(SignatureProof, 'Invalid SignatureProof - signature is invalid');
+            }
+        })().then(done, done.fail);
+    });
+
+    it('rejects valid proofs of another signer than the sender', (done) => {
+        (async function () {
+            const keyPair = KeyPair.generate();
+            const sender = KeyPair.generate().publicKey.toAddress();
+            const recipient = KeyPair.generate().publicKey.toAddress();
+            const tx = new ExtendedTransaction(sender, Account.Type.BASIC, recipient, Account.Type.BASIC, 1000, 0, 1, Transaction.Flag.NONE, new Uint8Array(0));
+            const signature = Signature.create(keyPair.privateKey, keyPair.publicKey, tx.serializeContent());
+            tx.proof = SignatureProof.singleSig(keyPair.publicKey, signature).serialize();
+
+            // The signature itself is valid, only the signer does not match the sender.
+            expect(signature.verify(keyPair.publicKey, tx.serializeContent())).toBe(true);
+
+            spyOn(Log, 'w');
+            expect(SignatureProof.verifyTransaction(tx)).toBe(false);
+            await SignatureProof.verifyTransactionsAsync([tx]);
+            expect(SignatureProof.verifyTransaction(tx)).toBe(false);
+            if (PlatformUtils.isNodeJs()) {
+                expect(Log.w).toHaveBeenCalledWith(SignatureProof, 'Invalid SignatureProof - signer does not match sender address');
+            }
+        })().then(done, done.fail);
+    });
+
+    it('does not reuse results for proofs changed after verifyTransactionsAsync', (done) => {
+        (async function () {
+            const keyPair = KeyPair.generate();
+            const wrongKey = KeyPair.generate();
+            const recipient = KeyPair.generate().publicKey.toAddress();
+            const transactions = [];
+            for (let i = 0; i < 3; ++i) {
+                const tx = new BasicTransaction(keyPair.publicKey, recipient, 1000 + i, 0, 1);
+                tx.signature = Signature.create(keyPair.privateKey, keyPair.publicKey, tx.serializeContent());
+                transactions.push(tx);
+            }
+            const validProof = transactions[2].proof;
+            transactions[2].proof = SignatureProof.singleSig(keyPair.publicKey,
+                Signature.create(wrongKey.privateKey, wrongKey.publicKey, transactions[2].serializeContent())).serialize();
+
+            await SignatureProof.verifyTransactionsAsync(transactions);
+            expect(SignatureProof.verifyTransaction(transactions[0])).toBe(true);
+            expect(SignatureProof.verifyTransaction(transactions[1])).toBe(true);
+            expect(SignatureProof.verifyTransaction(transactions[2])).toBe(false);
+
+            // Replace the proof of transaction 0 by one with a signature of the wrong key.
+            transactions[0].proof = SignatureProof.singleSig(keyPair.publicKey,
+                Signature.create(wrongKey.privateKey, wrongKey.publicKey, transactions[0].serializeContent())).serialize();
+            // Modify the signature in the proof of transaction 1 in place.
+            transactions[1].proof[transactions[1].proof.length - 1] ^= 1;
+            // Replace the invalid proof of transaction 2 by the valid one.
+            transactions[2].proof = validProof;
+
+            expect(SignatureProof.verifyTransaction(transactions[0])).toBe(false);
+            expect(SignatureProof.verifyTransaction(transactions[1])).toBe(false);
+            expect(SignatureProof.verifyTransaction(transactions[2])).toBe(true);
+        })().then(done, done.fail);
+    });
 });
@@ -0,0 +1,25 @@
+describe('NativeUtils', () => {
+    it('splits a range into consecutive chunks', (done) => {
+        (async function () {
+            const chunks = await NativeUtils.mapChunks(10, 4, async (start, end) => [start, end]);
+            expect(chunks).toEqual([[0, 3], [3, 6], [6, 9], [9, 10]]);
+            expect(await NativeUtils.mapChunks(2, 4, async (start, end) => [start, end])).toEqual([[0, 1], [1, 2]]);
+            expect(await NativeUtils.mapChunks(0, 4, async (start, end) => [start, end])).toEqual([]);
+        })().then(done, done.fail);
+    });
+
+    it('uses one chunk per thread of the native thread pool', () => {
+        expect(NativeUtils.THREADS).toBeGreaterThan(0);
+        if (!PlatformUtils.isNodeJs()) return;
+
+        const size = process.env.UV_THREADPOOL_SIZE;
+        try {
+            process.env.UV_THREADPOOL_SIZE = '7';
+            expect(NativeUtils.THREADS).toBe(7);
+            delete process.env.UV_THREADPOOL_SIZE;
+            expect(NativeUtils.THREADS).toBe(4);
+        } finally {
+            if (size !== undefined) process.env.UV_THREADPOOL_SIZE = size;
+        }
+    });
+});
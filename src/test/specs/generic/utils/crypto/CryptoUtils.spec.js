@@ -47,6 +47,19 @@ describe('CryptoUtils', () => {
         }
     });
 
+    it('can reuse a keyed HmacSha512 for many messages', () => {
+        // Test cases 6 and 7 from https://tools.ietf.org/html/rfc4231 share the same key
+        const hmac = new HmacSha512(BufferUtils.fromHex('aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa'));
+        const data6 = BufferUtils.fromHex('54657374205573696e67204c6172676572205468616e20426c6f636b2d53697a65204b6579202d2048617368204b6579204669727374');
+        const data7 = BufferUtils.fromHex('5468697320697320612074657374207573696e672061206c6172676572207468616e20626c6f636b2d73697a65206b657920616e642061206c6172676572207468616e20626c6f636b2d73697a6520646174612e20546865206b6579206e6565647320746f20626520686173686564206265666f7265206265696e6720757365642062792074686520484d414320616c676f726974686d2e');
+        const hash6 = '80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f3526b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598';
+        const hash7 = 'e37b6a775dc87dbaa4dfa9f96e5e3ffddebd71f8867289865df5a32d20cdc944b6022cac3c4982b10d5eeb55c3e4de15134676fb6de0446065c97440fa8c6a58';
+
+        expect(BufferUtils.toHex(hmac.compute(data6))).toBe(hash6);
+        expect(BufferUtils.toHex(hmac.compute(data7))).toBe(hash7);
+        expect(BufferUtils.toHex(hmac.compute(data6))).toBe(hash6);
+    });
+
     it('can correctly compute computePBKDF2sha512', () => {
         const vectors = [
             {
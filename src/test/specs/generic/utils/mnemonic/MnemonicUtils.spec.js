@@ -153,6 +153,25 @@ describe('MnemonicUtils', () => {
         }
     });
 
+    it('correctly computes seeds asynchronously', async () => {
+        // Test vectors from https://github.com/trezor/python-mnemonic/blob/master/vectors.json
+        const vectors = [
+            {
+                mnemonic: 'abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about',
+                seed: 'c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04',
+            },
+            {
+                mnemonic: 'legal winner thank year wave sausage worth useful legal winner thank yellow',
+                seed: '2e8905819b8723fe2c1d161860e5ee1830318dbf49a83bd451cfb8440c28bd6fa457fe1296106559a3c80937a1c1069be3a3a5bd381ee6260e8d9739fce1f607',
+            },
+        ];
+
+        const seeds = await Promise.all(vectors.map(vector => MnemonicUtils.mnemonicToSeedAsync(vector.mnemonic, 'TREZOR')));
+        for (let i = 0; i < vectors.length; i++) {
+            expect(BufferUtils.toHex(seeds[i])).toBe(vectors[i].seed);
+        }
+    });
+
     it('correctly computes mnemonic type', () => {
         expect(MnemonicUtils.getMnemonicType('void come effort suffer camp survey warrior heavy shoot primary clutch crush open amazing screen patrol group space point ten exist slush involve unfold')).toBe(MnemonicUtils.MnemonicType.BIP39);
         expect(MnemonicUtils.getMnemonicType('refuse walk suggest raven cheese gate eye divert base slot fossil lock oven fuel thank need unit oak image spike vehicle grace citizen expose')).toBe(MnemonicUtils.MnemonicType.LEGACY);